@@ -12,6 +12,7 @@
 #include "game/undo.h"
 #include "map/building_tiles.h"
 #include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/elevation.h"
 #include "map/grid.h"
 #include "map/random.h"
@@ -435,8 +436,11 @@ void building_update_state(void) {
     int aqueduct_recalc = 0;
     for (int i = 1; i < MAX_BUILDINGS[get_game_engine()]; i++) {
         building *b = &all_buildings[i];
-        if (b->state == BUILDING_STATE_CREATED)
+        if (b->state == BUILDING_STATE_CREATED) {
             b->state = BUILDING_STATE_VALID;
+            map_desirability_building_changed(i);
+            map_water_supply_building_changed(i);
+        }
 
         if (b->state != BUILDING_STATE_VALID || !b->house_size) {
             if (b->state == BUILDING_STATE_UNDO || b->state == BUILDING_STATE_DELETED_BY_PLAYER) {
@@ -514,6 +518,8 @@ int building_mothball_toggle(building *b) {
     } else if (b->state == BUILDING_STATE_MOTHBALLED)
         b->state = BUILDING_STATE_VALID;
 
+    map_desirability_building_changed(b->id);
+    map_water_supply_building_changed(b->id);
     return b->state;
 
 }
@@ -526,6 +532,8 @@ int building_mothball_set(building *b, int mothball) {
     } else if (b->state == BUILDING_STATE_MOTHBALLED)
         b->state = BUILDING_STATE_VALID;
 
+    map_desirability_building_changed(b->id);
+    map_water_supply_building_changed(b->id);
     return b->state;
 
 }
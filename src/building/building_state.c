@@ -10,9 +10,7 @@ static int is_industry_type(const building *b) {
 
 static void write_type_data(buffer *buf, const building *b) {
     if (building_is_house(b->type)) {
-        for (int i = 0; i < INVENTORY_MAX; i++) {
-            buf->write_i16(b->data.house.inventory[i]);
-        }
+        buf->write_array(b->data.house.inventory, INVENTORY_MAX);
         buf->write_u8(b->data.house.theater);
         buf->write_u8(b->data.house.amphitheater_actor);
         buf->write_u8(b->data.house.amphitheater_gladiator);
@@ -41,9 +39,7 @@ static void write_type_data(buffer *buf, const building *b) {
         buf->write_u8(b->data.house.evolve_text_id);
     } else if (b->type == BUILDING_MARKET) {
         buf->write_i16(0);
-        for (int i = 0; i < INVENTORY_MAX; i++) {
-            buf->write_i16(b->data.market.inventory[i]);
-        }
+        buf->write_array(b->data.market.inventory, INVENTORY_MAX);
         buf->write_i16(b->data.market.pottery_demand);
         buf->write_i16(b->data.market.furniture_demand);
         buf->write_i16(b->data.market.oil_demand);
@@ -74,9 +70,7 @@ static void write_type_data(buffer *buf, const building *b) {
         buf->write_u8(0);
         buf->write_u8(0);
         buf->write_u8(0);
-        for (int i = 0; i < 3; i++) {
-            buf->write_i16(b->data.dock.docker_ids[i]);
-        }
+        buf->write_array(b->data.dock.docker_ids, 3);
         buf->write_i16(b->data.dock.trade_ship_id);
     } else if (is_industry_type(b)) {
         buf->write_i16(b->data.industry.progress);
@@ -177,8 +171,7 @@ void building_state_save_to_buffer(buffer *buf, const building *b) {
 static void read_type_data(buffer *buf, building *b) {
     if (building_is_house(b->type)) {
         if (get_game_engine() == ENGINE_ENV_C3) {
-            for (int i = 0; i < INVENTORY_MAX; i++)
-                b->data.house.inventory[i] = buf->read_i16();
+            buf->read_array(b->data.house.inventory, INVENTORY_MAX);
         } else if (get_game_engine() == ENGINE_ENV_PHARAOH) {
             for (int i = 0; i < 9; i++)
                 b->data.house.foods_ph[i] = buf->read_i16();
@@ -216,9 +209,7 @@ static void read_type_data(buffer *buf, building *b) {
         b->data.house.evolve_text_id = buf->read_u8();
     } else if (b->type == BUILDING_MARKET) {
         buf->skip(2);
-        for (int i = 0; i < INVENTORY_MAX; i++) {
-            b->data.market.inventory[i] = buf->read_i16();
-        }
+        buf->read_array(b->data.market.inventory, INVENTORY_MAX);
         b->data.market.pottery_demand = buf->read_i16();
         b->data.market.furniture_demand = buf->read_i16();
         b->data.market.oil_demand = buf->read_i16();
@@ -243,9 +234,7 @@ static void read_type_data(buffer *buf, building *b) {
         buf->skip(2);
         b->data.dock.orientation = buf->read_i8();
         buf->skip(3);
-        for (int i = 0; i < 3; i++) {
-            b->data.dock.docker_ids[i] = buf->read_i16();
-        }
+        buf->read_array(b->data.dock.docker_ids, 3);
         b->data.dock.trade_ship_id = buf->read_i16();
     } else if (is_industry_type(b)) {
         if (get_game_engine() == ENGINE_ENV_PHARAOH)
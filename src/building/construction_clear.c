@@ -10,6 +10,8 @@
 #include "map/bridge.h"
 #include "map/building.h"
 #include "map/building_tiles.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/grid.h"
 #include "map/property.h"
 #include "map/routing_terrain.h"
@@ -93,6 +95,8 @@ static int clear_land_confirmed(int measure_only, int x_start, int y_start, int
                 }
                 b->state = BUILDING_STATE_DELETED_BY_PLAYER;
                 b->is_deleted = 1;
+                map_desirability_building_changed(b->id);
+                map_water_supply_building_changed(b->id);
                 building *space = b;
                 for (int i = 0; i < 99; i++) {
                     if (space->prev_part_building_id <= 0)
@@ -100,6 +104,8 @@ static int clear_land_confirmed(int measure_only, int x_start, int y_start, int
                     space = building_get(space->prev_part_building_id);
                     game_undo_add_building(space);
                     space->state = BUILDING_STATE_DELETED_BY_PLAYER;
+                    map_desirability_building_changed(space->id);
+                    map_water_supply_building_changed(space->id);
                 }
                 space = b;
                 for (int i = 0; i < 9; i++) {
@@ -108,6 +114,8 @@ static int clear_land_confirmed(int measure_only, int x_start, int y_start, int
                         break;
                     game_undo_add_building(space);
                     space->state = BUILDING_STATE_DELETED_BY_PLAYER;
+                    map_desirability_building_changed(space->id);
+                    map_water_supply_building_changed(space->id);
                 }
             } else if (map_terrain_is(grid_offset, TERRAIN_AQUEDUCT)) {
                 map_terrain_remove(grid_offset, TERRAIN_CLEARABLE);
@@ -9,6 +9,8 @@
 #include "game/undo.h"
 #include "map/building.h"
 #include "map/building_tiles.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/grid.h"
 #include "map/random.h"
 #include "map/routing_terrain.h"
@@ -43,6 +45,8 @@ static void destroy_on_fire(building *b, int plagued) {
         num_tiles = 0;
     }
     map_building_tiles_remove(b->id, b->x, b->y);
+    map_desirability_building_changed(b->id);
+    map_water_supply_building_changed(b->id);
     if (map_terrain_is(b->grid_offset, TERRAIN_WATER))
         b->state = BUILDING_STATE_DELETED_BY_GAME;
     else {
@@ -111,6 +115,8 @@ static void destroy_linked_parts(building *b, int on_fire) {
         else {
             map_building_tiles_set_rubble(part_id, part->x, part->y, part->size);
             part->state = BUILDING_STATE_RUBBLE;
+            map_desirability_building_changed(part->id);
+            map_water_supply_building_changed(part->id);
         }
     }
 
@@ -125,12 +131,16 @@ static void destroy_linked_parts(building *b, int on_fire) {
         else {
             map_building_tiles_set_rubble(part->id, part->x, part->y, part->size);
             part->state = BUILDING_STATE_RUBBLE;
+            map_desirability_building_changed(part->id);
+            map_water_supply_building_changed(part->id);
         }
     }
 }
 
 void building_destroy_by_collapse(building *b) {
     b->state = BUILDING_STATE_RUBBLE;
+    map_desirability_building_changed(b->id);
+    map_water_supply_building_changed(b->id);
     map_building_tiles_set_rubble(b->id, b->x, b->y, b->size);
     figure_create_explosion_cloud(b->x, b->y, b->size);
     destroy_linked_parts(b, 0);
@@ -153,6 +163,8 @@ int building_destroy_first_of_type(int type) {
         int grid_offset = b->grid_offset;
         game_undo_disable();
         b->state = BUILDING_STATE_RUBBLE;
+        map_desirability_building_changed(i);
+        map_water_supply_building_changed(i);
         map_building_tiles_set_rubble(i, b->x, b->y, b->size);
         sound_effect_play(SOUND_EFFECT_EXPLOSION);
         map_routing_update_land();
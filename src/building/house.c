@@ -6,6 +6,8 @@
 #include "game/resource.h"
 #include "map/building.h"
 #include "map/building_tiles.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/grid.h"
 #include "map/image.h"
 #include "map/random.h"
@@ -104,6 +106,8 @@ static void create_vacant_lot(int x, int y, int image_id) {
 
 void building_house_change_to(building *house, int type) {
     house->type = type;
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     int image_id = image_id_from_group(HOUSE_IMAGE[house->subtype.house_level].group);
     if (house->house_is_merged) {
@@ -119,6 +123,8 @@ void building_house_change_to(building *house, int type) {
 }
 void building_house_change_to_vacant_lot(building *house) {
     house->type = BUILDING_HOUSE_VACANT_LOT;
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
     house->subtype.house_level = house->type - BUILDING_HOUSE_VACANT_LOT;
     int image_id = image_id_from_group(GROUP_BUILDING_HOUSE_VACANT_LOT);
     if (house->house_is_merged) {
@@ -150,6 +156,8 @@ static void prepare_for_merge(int building_id, int num_tiles) {
                     merge_data.inventory[inv] += house->data.house.inventory[inv];
                     house->house_population = 0;
                     house->state = BUILDING_STATE_DELETED_BY_GAME;
+                    map_desirability_building_changed(house->id);
+                    map_water_supply_building_changed(house->id);
                 }
             }
         }
@@ -173,6 +181,8 @@ static void merge(building *b) {
     b->y = merge_data.y;
     b->grid_offset = map_grid_offset(b->x, b->y);
     b->house_is_merged = 1;
+    map_desirability_building_changed(b->id);
+    map_water_supply_building_changed(b->id);
     map_building_tiles_add(b->id, b->x, b->y, 2, image_id, TERRAIN_BUILDING);
 }
 
@@ -321,6 +331,8 @@ static void split_size2(building *house, int new_type) {
         house->data.house.inventory[i] = inventory_per_tile[i] + inventory_remainder[i];
     }
     house->distance_from_entry = 0;
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
 
     int image_id = house_image_group(house->subtype.house_level);
     map_building_tiles_add(house->id, house->x, house->y, house->size,
@@ -353,6 +365,8 @@ static void split_size3(building *house) {
         house->data.house.inventory[i] = inventory_per_tile[i] + inventory_remainder[i];
     }
     house->distance_from_entry = 0;
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
 
     int image_id = house_image_group(house->subtype.house_level);
     map_building_tiles_add(house->id, house->x, house->y, house->size,
@@ -403,6 +417,8 @@ void building_house_expand_to_large_insula(building *house) {
     house->x = merge_data.x;
     house->y = merge_data.y;
     house->grid_offset = map_grid_offset(house->x, house->y);
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
     map_building_tiles_add(house->id, house->x, house->y, house->size, image_id, TERRAIN_BUILDING);
 }
 void building_house_expand_to_large_villa(building *house) {
@@ -421,6 +437,8 @@ void building_house_expand_to_large_villa(building *house) {
     house->x = merge_data.x;
     house->y = merge_data.y;
     house->grid_offset = map_grid_offset(house->x, house->y);
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
     map_building_tiles_add(house->id, house->x, house->y, house->size, image_id, TERRAIN_BUILDING);
 }
 void building_house_expand_to_large_palace(building *house) {
@@ -439,6 +457,8 @@ void building_house_expand_to_large_palace(building *house) {
     house->x = merge_data.x;
     house->y = merge_data.y;
     house->grid_offset = map_grid_offset(house->x, house->y);
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
     map_building_tiles_add(house->id, house->x, house->y, house->size, image_id, TERRAIN_BUILDING);
 }
 void building_house_devolve_from_large_insula(building *house) {
@@ -466,6 +486,8 @@ void building_house_devolve_from_large_villa(building *house) {
         house->data.house.inventory[i] = inventory_per_tile[i] + inventory_remainder[i];
     }
     house->distance_from_entry = 0;
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
 
     int image_id = house_image_group(house->subtype.house_level);
     map_building_tiles_add(house->id, house->x, house->y, house->size,
@@ -506,6 +528,8 @@ void building_house_devolve_from_large_palace(building *house) {
         house->data.house.inventory[i] = inventory_per_tile[i] + inventory_remainder[i];
     }
     house->distance_from_entry = 0;
+    map_desirability_building_changed(house->id);
+    map_water_supply_building_changed(house->id);
 
     int image_id = house_image_group(house->subtype.house_level);
     map_building_tiles_add(house->id, house->x, house->y, house->size, image_id, TERRAIN_BUILDING);
@@ -544,6 +568,8 @@ void building_house_check_for_corruption(building *house) {
                     house->grid_offset = grid_offset; // set house offset to this tile's offset (i.e. lowest x & y; north-west corner)
                     house->x = map_grid_offset_to_x(grid_offset); // set house coords (x) to tile's coords (x)
                     house->y = map_grid_offset_to_y(grid_offset); // set house coords (y) to tile's coords (y)
+                    map_desirability_building_changed(house->id);
+                    map_water_supply_building_changed(house->id);
 //                    building_totals_add_corrupted_house(0);
                     return;
                 }
@@ -551,5 +577,7 @@ void building_house_check_for_corruption(building *house) {
         }
 //        building_totals_add_corrupted_house(1);
         house->state = BUILDING_STATE_RUBBLE;
+        map_desirability_building_changed(house->id);
+        map_water_supply_building_changed(house->id);
     }
 }
@@ -5,6 +5,8 @@
 #include "city/houses.h"
 #include "city/resource.h"
 #include "core/calc.h"
+#include "core/game_environment.h"
+#include "core/log.h"
 #include "game/resource.h"
 #include "game/time.h"
 #include "map/building.h"
@@ -12,13 +14,50 @@
 #include "map/routing_terrain.h"
 #include "map/tiles.h"
 
+#include <string.h>
+
 enum {
     EVOLVE = 1,
     NONE = 0,
     DEVOLVE = -1
 };
 
-static int check_evolve_desirability(building *house) {
+#define NUM_DEMAND_COUNTERS ((int) (sizeof(house_demands) / sizeof(int)))
+
+// Everything the evolve checks of a house look at, with service levels and goods clamped to the
+// highest threshold of the current and next level: when these are unchanged, so is the outcome.
+typedef struct {
+    uint8_t type;
+    uint8_t is_merged;
+    uint8_t has_people;
+    uint8_t has_water_access;
+    uint8_t has_well_access;
+    uint8_t multiple_wine;
+    int8_t desirability_status;
+    uint8_t food_types;
+    uint8_t entertainment;
+    uint8_t education;
+    uint8_t num_gods;
+    uint8_t barber;
+    uint8_t bathhouse;
+    uint8_t health;
+    uint8_t goods[4];
+} house_inputs;
+
+// Houses whose last evaluation changed nothing are skipped while their inputs stay the same;
+// the demands they added to the city totals are replayed instead
+static struct {
+    struct {
+        int is_idle;
+        house_inputs inputs;
+        uint8_t evolve_text_id;
+        uint8_t devolve_delay;
+        uint8_t demands[NUM_DEMAND_COUNTERS];
+    } houses[4000];
+    int last_status;
+} data;
+
+static int desirability_status(const building *house) {
     int level = house->subtype.house_level;
     const model_house *model = model_get_house(level);
     int evolve_des = model->evolve_desirability;
@@ -26,14 +65,16 @@ static int check_evolve_desirability(building *house) {
         evolve_des = 1000;
 
     int current_des = house->desirability;
-    int status;
     if (current_des <= model->devolve_desirability)
-        status = DEVOLVE;
+        return DEVOLVE;
     else if (current_des >= evolve_des)
-        status = EVOLVE;
+        return EVOLVE;
     else {
-        status = NONE;
+        return NONE;
     }
+}
+static int check_evolve_desirability(building *house) {
+    int status = desirability_status(house);
     house->data.house.evolve_text_id = status; // BUG? -1 in an unsigned char?
     return status;
 }
@@ -169,6 +210,7 @@ static int check_requirements(building *house, house_demands *demands) {
     else if (status == EVOLVE)
         status = has_required_goods_and_services(house, 1, demands);
 
+    data.last_status = status;
     return status;
 }
 
@@ -438,6 +480,8 @@ static int evolve_luxury_palace(building *house, house_demands *demands) {
     if (!has_required_goods_and_services(house, 0, demands))
         status = DEVOLVE;
 
+    // staying a luxury palace is the only outcome other than devolving
+    data.last_status = status == DEVOLVE ? DEVOLVE : NONE;
     if (!has_devolve_delay(house, status) && status == DEVOLVE)
         building_house_change_to(house, BUILDING_HOUSE_LARGE_PALACE);
 
@@ -470,6 +514,88 @@ static int (*evolve_callback[])(building *, house_demands *) = {
         evolve_small_palace, evolve_medium_palace, evolve_large_palace, evolve_luxury_palace
 };
 
+static uint8_t clamp_input(int value, int threshold, int next_threshold) {
+    int max = threshold > next_threshold ? threshold : next_threshold;
+    return value < max ? value : max;
+}
+static void read_inputs(const building *house, house_inputs *inputs) {
+    int level = house->subtype.house_level;
+    const model_house *model = model_get_house(level);
+    const model_house *next = model_get_house(level < HOUSE_LUXURY_PALACE ? level + 1 : level);
+    memset(inputs, 0, sizeof(house_inputs));
+    inputs->type = house->type;
+    inputs->is_merged = house->house_is_merged;
+    inputs->has_people = house->house_population > 0;
+    inputs->has_water_access = house->has_water_access;
+    inputs->has_well_access = house->has_well_access;
+    inputs->multiple_wine = city_resource_multiple_wine_available() ? 1 : 0;
+    inputs->desirability_status = desirability_status(house);
+    for (int i = INVENTORY_MIN_FOOD; i < INVENTORY_MAX_FOOD; i++) {
+        if (house->data.house.inventory[i])
+            inputs->food_types |= 1 << i;
+    }
+    inputs->entertainment = clamp_input(house->data.house.entertainment, model->entertainment, next->entertainment);
+    inputs->education = clamp_input(house->data.house.education, model->education, next->education);
+    inputs->num_gods = clamp_input(house->data.house.num_gods, model->religion, next->religion);
+    inputs->barber = clamp_input(house->data.house.barber, model->barber, next->barber);
+    inputs->bathhouse = clamp_input(house->data.house.bathhouse, model->bathhouse, next->bathhouse);
+    inputs->health = clamp_input(house->data.house.health, model->health, next->health);
+    inputs->goods[0] = clamp_input(house->data.house.inventory[INVENTORY_GOOD1], model->pottery, next->pottery);
+    inputs->goods[1] = clamp_input(house->data.house.inventory[INVENTORY_GOOD2], model->furniture, next->furniture);
+    inputs->goods[2] = clamp_input(house->data.house.inventory[INVENTORY_GOOD3], model->oil, next->oil);
+    inputs->goods[3] = clamp_input(house->data.house.inventory[INVENTORY_GOOD4], 1, 1);
+}
+static int can_skip(const building *house, const house_inputs *inputs) {
+    if (!data.houses[house->id].is_idle)
+        return 0;
+    // small houses may merge with their neighbours
+    if (house->subtype.house_level <= HOUSE_MEDIUM_INSULA && !house->house_is_merged)
+        return 0;
+    // the evolve text is also written when the house info is shown, and saves bring their own delays
+    if (house->data.house.evolve_text_id != data.houses[house->id].evolve_text_id
+        || house->data.house.devolve_delay != data.houses[house->id].devolve_delay)
+        return 0;
+    return memcmp(&data.houses[house->id].inputs, inputs, sizeof(house_inputs)) == 0;
+}
+static void replay_demands(const building *house, house_demands *demands) {
+    int *counters = (int *) demands;
+    for (int i = 0; i < NUM_DEMAND_COUNTERS; i++)
+        counters[i] += data.houses[house->id].demands[i];
+}
+static int evolve_house(building *house, house_demands *demands) {
+    house_inputs inputs;
+    read_inputs(house, &inputs);
+    int skip = can_skip(house, &inputs);
+    if (skip && !is_debug_mode()) {
+        replay_demands(house, demands);
+        return 0;
+    }
+    int id = house->id;
+    house_demands before = *demands;
+    data.last_status = NONE;
+    int has_expanded = evolve_callback[house->type - BUILDING_HOUSE_VACANT_LOT](house, demands);
+
+    const int *counters_before = (const int *) &before;
+    const int *counters_after = (const int *) demands;
+    uint8_t added[NUM_DEMAND_COUNTERS];
+    for (int i = 0; i < NUM_DEMAND_COUNTERS; i++)
+        added[i] = counters_after[i] - counters_before[i];
+
+    if (skip && (data.last_status != NONE || memcmp(added, data.houses[id].demands, sizeof(added)) != 0))
+        log_error("House evolution skipped a house that changed:", 0, id);
+
+    // the house may have been replaced or resized: it only counts as idle if it stayed the same
+    data.houses[id].is_idle = !has_expanded && data.last_status == NONE && house->id == id
+            && house->state == BUILDING_STATE_VALID && house->type == inputs.type;
+    if (data.houses[id].is_idle) {
+        read_inputs(house, &data.houses[id].inputs);
+        data.houses[id].evolve_text_id = house->data.house.evolve_text_id;
+        data.houses[id].devolve_delay = house->data.house.devolve_delay;
+        memcpy(data.houses[id].demands, added, sizeof(added));
+    }
+    return has_expanded;
+}
+
 void building_house_process_evolve_and_consume_goods(void) {
     city_houses_reset_demands();
     house_demands *demands = city_houses_demands();
@@ -478,10 +604,12 @@ void building_house_process_evolve_and_consume_goods(void) {
         building *b = building_get(i);
         if (b->state == BUILDING_STATE_VALID && building_is_house(b->type)) {
             building_house_check_for_corruption(b);
-            has_expanded |= evolve_callback[b->type - BUILDING_HOUSE_VACANT_LOT](b, demands);
+            has_expanded |= evolve_house(b, demands);
             if (game_time_day() == 0 || game_time_day() == 7)
                 consume_resources(b);
 
+        } else {
+            data.houses[i].is_idle = 0;
         }
     }
     if (has_expanded)
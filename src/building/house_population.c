@@ -10,6 +10,9 @@
 #include "core/calc.h"
 #include "figuretype/migrant.h"
 #include "core/game_environment.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
+#include "platform/jobs.h"
 
 int house_population_add_to_city(int num_people) {
     int added = 0;
@@ -65,21 +68,24 @@ static void fill_building_list_with_houses(void) {
     }
 }
 
-void house_population_update_room(void) {
-    city_population_clear_capacity();
+struct room_totals {
+    const int *houses;
+    int people[PLATFORM_JOBS_MAX_WORKERS];
+    int max_people[PLATFORM_JOBS_MAX_WORKERS];
+};
 
-    fill_building_list_with_houses();
-    int total_houses = building_list_large_size();
-    const int *houses = building_list_large_items();
-    for (int i = 0; i < total_houses; i++) {
-        building *b = building_get(houses[i]);
+static void update_room(int worker, int begin, int end, void *user_data) {
+    struct room_totals *totals = (struct room_totals *) user_data;
+    for (int i = begin; i < end; i++) {
+        building *b = building_get(totals->houses[i]);
         b->house_population_room = 0;
         if (b->distance_from_entry > 0) {
             int max_pop = model_get_house(b->subtype.house_level)->max_people;
             if (b->house_is_merged)
                 max_pop *= 4;
 
-            city_population_add_capacity(b->house_population, max_pop);
+            totals->people[worker] += b->house_population;
+            totals->max_people[worker] += max_pop;
             b->house_population_room = max_pop - b->house_population;
             if (b->house_population > b->house_highest_population)
                 b->house_highest_population = b->house_population;
@@ -90,6 +96,15 @@ void house_population_update_room(void) {
         }
     }
 }
+void house_population_update_room(void) {
+    city_population_clear_capacity();
+
+    fill_building_list_with_houses();
+    struct room_totals totals = {building_list_large_items()};
+    platform_jobs_parallel_for(building_list_large_size(), update_room, &totals);
+    for (int w = 0; w < PLATFORM_JOBS_MAX_WORKERS; w++)
+        city_population_add_capacity(totals.people[w], totals.max_people[w]);
+}
 
 int house_population_create_immigrants(int num_people) {
     int total_houses = building_list_large_size();
@@ -222,9 +237,12 @@ void house_population_evict_overcrowded(void) {
             figure_create_homeless(b->x, b->y, num_people_to_evict);
             if (num_people_to_evict < b->house_population)
                 b->house_population -= num_people_to_evict;
-            else
+            else {
                 // house has been removed
                 b->state = BUILDING_STATE_UNDO;
+                map_desirability_building_changed(b->id);
+                map_water_supply_building_changed(b->id);
+            }
         }
     }
 }
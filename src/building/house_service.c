@@ -3,6 +3,7 @@
 #include "building/building.h"
 #include "city/culture.h"
 #include "core/game_environment.h"
+#include "map/water_supply.h"
 
 static void decay(unsigned char *value) {
     if (*value > 0)
@@ -29,6 +30,8 @@ void house_service_decay_culture(void) {
         decay(&b->data.house.academy);
         decay(&b->data.house.barber);
         decay(&b->data.house.clinic);
+        if (b->data.house.bathhouse == 1)
+            map_water_supply_building_changed(i);
         decay(&b->data.house.bathhouse);
         decay(&b->data.house.hospital);
         decay(&b->data.house.temple_ceres);
@@ -49,9 +52,10 @@ void house_service_decay_tax_collector(void) {
 }
 
 #include "building/industry.h"
+#include "platform/jobs.h"
 
-void house_service_decay_houses_covered(void) {
-    for (int i = 1; i < MAX_BUILDINGS[get_game_engine()]; i++) {
+static void decay_houses_covered(int worker, int begin, int end, void *user_data) {
+    for (int i = begin ? begin : 1; i < end; i++) {
         building *b = building_get(i);
         if (b->state != BUILDING_STATE_UNUSED && b->type != BUILDING_TOWER) {
             if (building_is_farm(b->type))
@@ -72,6 +76,10 @@ void house_service_decay_houses_covered(void) {
         }
     }
 }
+void house_service_decay_houses_covered(void) {
+    // every building only touches its own fields, so the range can be split freely
+    platform_jobs_parallel_for(MAX_BUILDINGS[get_game_engine()], decay_houses_covered, 0);
+}
 
 void house_service_calculate_culture_aggregates(void) {
     int base_entertainment = city_culture_coverage_average_entertainment() / 5;
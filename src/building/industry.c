@@ -7,6 +7,7 @@
 #include "game/resource.h"
 #include "map/building_tiles.h"
 #include "map/road_access.h"
+#include "platform/jobs.h"
 #include "scenario/property.h"
 
 #define MAX_PROGRESS_RAW 200
@@ -127,9 +128,11 @@ int building_determine_worker_needed() {
     return 0; // temp
 }
 
-void building_industry_update_production(void) {
-    for (int i = 1; i < MAX_BUILDINGS[get_game_engine()]; i++) {
+static void update_production(int worker, int begin, int end, void *user_data) {
+    uint8_t *needs_farm_image = (uint8_t *) user_data;
+    for (int i = begin ? begin : 1; i < end; i++) {
         building *b = building_get(i);
+        needs_farm_image[i] = 0;
         if (b->state != BUILDING_STATE_VALID || !b->output_resource_id)
             continue;
         b->data.industry.has_raw_materials = 0;
@@ -158,10 +161,23 @@ void building_industry_update_production(void) {
                 b->data.industry.progress = max;
 
             if (building_is_farm(b->type))
-                update_farm_image(b);
+                needs_farm_image[i] = 1;
         }
     }
 }
+void building_industry_update_production(void) {
+    static uint8_t needs_farm_image[4000];
+    int max_buildings = MAX_BUILDINGS[get_game_engine()];
+    // make sure the fertility grid is allocated before the workers read it
+    map_get_fertility(0);
+    platform_jobs_parallel_for(max_buildings, update_production, needs_farm_image);
+
+    // farm images write to the shared map grids, so they are applied afterwards in building order
+    for (int i = 1; i < max_buildings; i++) {
+        if (needs_farm_image[i])
+            update_farm_image(building_get(i));
+    }
+}
 void building_industry_update_wheat_production(void) {
     if (scenario_property_climate() == CLIMATE_NORTHERN)
         return;
@@ -17,6 +17,8 @@
 #include "game/undo.h"
 #include "map/building.h"
 #include "map/building_tiles.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/grid.h"
 #include "map/random.h"
 #include "map/road_access.h"
@@ -50,6 +52,8 @@ void building_maintenance_update_burning_ruins(void) {
         if (b->fire_duration > 32) {
             game_undo_disable();
             b->state = BUILDING_STATE_RUBBLE;
+            map_desirability_building_changed(i);
+            map_water_supply_building_changed(i);
             map_building_tiles_set_rubble(i, b->x, b->y, b->size);
             recalculate_terrain = 1;
             continue;
@@ -241,6 +245,8 @@ void building_maintenance_check_rome_access(void) {
                         b->house_unreachable_ticks = 0;
                     }
                     b->state = BUILDING_STATE_UNDO;
+                    map_desirability_building_changed(b->id);
+                    map_water_supply_building_changed(b->id);
                 }
             } else if (map_routing_distance(map_grid_offset(x_road, y_road))) {
                 // reachable from rome
@@ -259,6 +265,8 @@ void building_maintenance_check_rome_access(void) {
                     b->distance_from_entry = 0;
                     b->house_unreachable_ticks = 0;
                     b->state = BUILDING_STATE_UNDO;
+                    map_desirability_building_changed(b->id);
+                    map_water_supply_building_changed(b->id);
                 }
             }
         } else if (b->type == BUILDING_WAREHOUSE) {
@@ -1126,6 +1126,15 @@ void city_data_save_state(buffer *main, buffer *faction, buffer *faction_unknown
     save_entry_exit(entry_exit_xy, entry_exit_grid_offset);
 }
 
+void city_data_read_summary(buffer *main, int *treasury, int *population) {
+    // same layout as load_main_data: other player data, 8 single bytes, then tax percentage
+    main->skip(get_game_engine() == ENGINE_ENV_C3 ? 18068 : 18068 + 836);
+    main->skip(8 + 4);
+    *treasury = main->read_i32();
+    // sentiment, health target, health, hospital workers, unknown
+    main->skip(5 * 4);
+    *population = main->read_i32();
+}
 void city_data_load_state(buffer *main, buffer *faction, buffer *faction_unknown, buffer *graph_order, buffer *entry_exit_xy,
                      buffer *entry_exit_grid_offset, buffer *floodplain_settings) {
     load_main_data(main);
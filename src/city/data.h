@@ -15,4 +15,12 @@ void city_data_save_state(buffer *main, buffer *faction, buffer *faction_unknown
 void city_data_load_state(buffer *main, buffer *faction, buffer *faction_unknown, buffer *graph_order, buffer *entry_exit_xy,
                      buffer *entry_exit_grid_offset, buffer *floodplain_settings);
 
+/**
+ * Reads the treasury and population from saved city data without loading it
+ * @param main Main city data as stored in the save
+ * @param treasury Treasury to fill
+ * @param population Population to fill
+ */
+void city_data_read_summary(buffer *main, int *treasury, int *population);
+
 #endif // CITY_DATA_H
@@ -6,6 +6,8 @@
 #include "core/string.h"
 #include "core/time.h"
 #include "figure/formation.h"
+#include "game/fast_forward.h"
+#include "game/forecast.h"
 #include "game/time.h"
 #include "graphics/window.h"
 #include "sound/effect.h"
@@ -151,6 +153,11 @@ void city_message_apply_sound_interval(int category) {
 void city_message_post(int use_popup, int message_id, int param1, int param2) {
 
     use_popup = 1; // temp
+    if (game_forecast_is_running()) {
+        // forecast messages are discarded with the rest of the forecast
+        use_popup = 0;
+        should_play_sound = 0;
+    }
 
     int id = new_message_id();
     if (id < 0)
@@ -171,6 +178,7 @@ void city_message_post(int use_popup, int message_id, int param1, int param2) {
 
     int text_id = city_message_get_text_id(message_id);
     int lang_msg_type = lang_get_message(text_id)->message_type;
+    game_fast_forward_on_message(lang_msg_type);
     if (lang_msg_type == MESSAGE_TYPE_DISASTER || lang_msg_type == MESSAGE_TYPE_INVASION) {
         data.problem_count = 1;
         window_invalidate();
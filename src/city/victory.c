@@ -6,6 +6,7 @@
 #include "city/finance.h"
 #include "city/message.h"
 #include "core/config.h"
+#include "game/forecast.h"
 #include "game/time.h"
 #include "scenario/criteria.h"
 #include "scenario/property.h"
@@ -134,7 +135,7 @@ static int determine_victory_state(void) {
 }
 
 void city_victory_check(void) {
-    if (scenario_is_open_play())
+    if (scenario_is_open_play() || game_forecast_is_running())
         return;
     data.state = determine_victory_state();
 
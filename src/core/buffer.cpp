@@ -67,7 +67,7 @@ bool buffer::is_valid(size_t count) const {
 uint8_t buffer::read_u8() {
     uint8_t result = 0;
     if (is_valid(sizeof(result))) {
-        result = data.at(index++);
+        result = data[index++];
     }
 
     return result;
@@ -76,8 +76,8 @@ uint8_t buffer::read_u8() {
 uint16_t buffer::read_u16() {
     uint16_t result = 0;
     if (is_valid(sizeof(result))) {
-        uint8_t b0 = data.at(index++);
-        uint8_t b1 = data.at(index++);
+        uint8_t b0 = data[index++];
+        uint8_t b1 = data[index++];
         result = (uint16_t) (b0 | (b1 << 8));
     }
 
@@ -87,10 +87,10 @@ uint16_t buffer::read_u16() {
 uint32_t buffer::read_u32() {
     uint32_t result = 0;
     if (is_valid(sizeof(result))) {
-        uint8_t b0 = data.at(index++);
-        uint8_t b1 = data.at(index++);
-        uint8_t b2 = data.at(index++);
-        uint8_t b3 = data.at(index++);
+        uint8_t b0 = data[index++];
+        uint8_t b1 = data[index++];
+        uint8_t b2 = data[index++];
+        uint8_t b3 = data[index++];
         result =  (uint32_t) (b0 | (b1 << 8) | (b2 << 16) | (b3 << 24));
     }
 
@@ -100,7 +100,7 @@ uint32_t buffer::read_u32() {
 int8_t buffer::read_i8() {
     int8_t result = 0;
     if (is_valid(sizeof(result))) {
-        result = data.at(index++);
+        result = data[index++];
     }
 
     return result;
@@ -108,8 +108,8 @@ int8_t buffer::read_i8() {
 int16_t buffer::read_i16() {
     int16_t result = 0;
     if (is_valid(sizeof(result))) {
-        uint8_t b0 = data.at(index++);
-        uint8_t b1 = data.at(index++);
+        uint8_t b0 = data[index++];
+        uint8_t b1 = data[index++];
         result = (uint16_t) (b0 | (b1 << 8));
     }
 
@@ -118,10 +118,10 @@ int16_t buffer::read_i16() {
 int32_t buffer::read_i32() {
     int32_t result = 0;
     if (is_valid(sizeof(result))) {
-        uint8_t b0 = data.at(index++);
-        uint8_t b1 = data.at(index++);
-        uint8_t b2 = data.at(index++);
-        uint8_t b3 = data.at(index++);
+        uint8_t b0 = data[index++];
+        uint8_t b1 = data[index++];
+        uint8_t b2 = data[index++];
+        uint8_t b3 = data[index++];
         result =  (int32_t) (b0 | (b1 << 8) | (b2 << 16) | (b3 << 24));
     }
 
@@ -130,8 +130,8 @@ int32_t buffer::read_i32() {
 
 size_t buffer::read_raw(void *value, size_t s) {
     size_t result = 0;
-    if (is_valid(sizeof(result))) {
-        memcpy(value, &data.at(index), s);
+    if (s && is_valid(s)) {
+        memcpy(value, &data[index], s);
         index += s;
         result = s;
     }
@@ -145,48 +145,48 @@ void buffer::fill(uint8_t val) {
 
 void buffer::write_u8(uint8_t value) {
     if (is_valid(sizeof(value))) {
-        data.at(index++) = value;
+        data[index++] = value;
     }
 }
 
 void buffer::write_u16(uint16_t value) {
     if (is_valid(sizeof(value))) {
-        data.at(index++) = value & 0xff;
-        data.at(index++) = (value >> 8) & 0xff;
+        data[index++] = value & 0xff;
+        data[index++] = (value >> 8) & 0xff;
     }
 }
 
 void buffer::write_u32(uint32_t value) {
     if (is_valid(sizeof(value))) {
-        data.at(index++) = value & 0xff;
-        data.at(index++) = (value >> 8) & 0xff;
-        data.at(index++) = (value >> 16) & 0xff;
-        data.at(index++) = (value >> 24) & 0xff;
+        data[index++] = value & 0xff;
+        data[index++] = (value >> 8) & 0xff;
+        data[index++] = (value >> 16) & 0xff;
+        data[index++] = (value >> 24) & 0xff;
     }
 }
 
 void buffer::write_i8(int8_t value) {
     if (is_valid(sizeof(value))) {
-        data.at(index++) = value & 0xff;
+        data[index++] = value & 0xff;
     }
 }
 void buffer::write_i16(int16_t value) {
     if (is_valid(sizeof(value))) {
-        data.at(index++) = value & 0xff;
-        data.at(index++) = (value >> 8) & 0xff;
+        data[index++] = value & 0xff;
+        data[index++] = (value >> 8) & 0xff;
     }
 }
 void buffer::write_i32(int32_t value) {
     if (is_valid(sizeof(value))) {
-        data.at(index++) = value & 0xff;
-        data.at(index++) = (value >> 8) & 0xff;
-        data.at(index++) = (value >> 16) & 0xff;
-        data.at(index++) = (value >> 24) & 0xff;
+        data[index++] = value & 0xff;
+        data[index++] = (value >> 8) & 0xff;
+        data[index++] = (value >> 16) & 0xff;
+        data[index++] = (value >> 24) & 0xff;
     }
 }
 void buffer::write_raw(const void *value, size_t s) {
-    if (is_valid(s)) {
-        memcpy(&data.at(index), value, s);
+    if (s && is_valid(s)) {
+        memcpy(&data[index], value, s);
         index += s;
     }
 }
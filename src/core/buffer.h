@@ -3,8 +3,16 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <type_traits>
 #include <vector>
 
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define BUFFER_HOST_BIG_ENDIAN 1
+#else
+#define BUFFER_HOST_BIG_ENDIAN 0
+#endif
+
 /**
 * @file
 * Read to or write from memory buffer.
@@ -54,6 +62,58 @@ public:
     void write_i32(int32_t value);
     void write_raw(const void *value, size_t s);
 
+    /**
+     * Reads up to count little-endian values of type T into dst with a single bounds check.
+     * Stops early at the end of the buffer.
+     * @return Number of values read
+     */
+    template <typename T>
+    size_t read_array(T *dst, size_t count) {
+        static_assert(std::is_integral<T>::value, "read_array only supports integer types");
+        size_t available = (index < size()) ? (size() - index) / sizeof(T) : 0;
+        if (count > available)
+            count = available;
+        if (!count)
+            return 0;
+        const uint8_t *src = &data[index];
+        if (sizeof(T) == 1 || !BUFFER_HOST_BIG_ENDIAN) {
+            memcpy(dst, src, count * sizeof(T));
+        } else {
+            for (size_t i = 0; i < count; i++, src += sizeof(T)) {
+                typename std::make_unsigned<T>::type value = 0;
+                for (size_t b = 0; b < sizeof(T); b++)
+                    value |= (typename std::make_unsigned<T>::type) src[b] << (8 * b);
+                dst[i] = (T) value;
+            }
+        }
+        index += count * sizeof(T);
+        return count;
+    }
+
+    /**
+     * Writes count values of type T from src in little-endian order with a single bounds check.
+     * Nothing is written if the values do not fit.
+     * @return Number of values written
+     */
+    template <typename T>
+    size_t write_array(const T *src, size_t count) {
+        static_assert(std::is_integral<T>::value, "write_array only supports integer types");
+        if (!count || !is_valid(count * sizeof(T)))
+            return 0;
+        uint8_t *dst = &data[index];
+        if (sizeof(T) == 1 || !BUFFER_HOST_BIG_ENDIAN) {
+            memcpy(dst, src, count * sizeof(T));
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                typename std::make_unsigned<T>::type value = src[i];
+                for (size_t b = 0; b < sizeof(T); b++)
+                    *dst++ = (value >> (8 * b)) & 0xff;
+            }
+        }
+        index += count * sizeof(T);
+        return count;
+    }
+
     size_t from_file(size_t count, FILE *__restrict__ fp);
     size_t to_file(size_t count, FILE *__restrict__ fp) const;
 };
@@ -49,6 +49,11 @@ static const char *ini_keys[] = {
         "gameplay_change_multiple_barracks",
         "gameplay_change_warehouses_dont_accept",
         "gameplay_change_houses_dont_expand_into_gardens",
+        "gameplay_change_limit_routes_per_tick",
+        "ui_fast_forward_stop_on_message",
+        "ui_fast_forward_stop_on_invasion",
+        "ui_fast_forward_stop_on_request",
+        "ui_fast_forward_stop_on_population",
 
 };
 
@@ -96,6 +101,11 @@ static char string_values[CONFIG_STRING_MAX_ENTRIES][CONFIG_STRING_VALUE_MAX];
 #define CONFIG_DEFAULT_GP_CH_MULTIPLE_BARRACKS 0
 #define CONFIG_DEFAULT_GP_CH_WAREHOUSES_DONT_ACCEPT 0
 #define CONFIG_DEFAULT_GP_CH_HOUSES_DONT_EXPAND_INTO_GARDENS 0
+#define CONFIG_DEFAULT_GP_CH_LIMIT_ROUTES_PER_TICK 0
+#define CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_MESSAGE 0
+#define CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_INVASION 1
+#define CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_REQUEST 1
+#define CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_POPULATION 0
 
 static int default_values[CONFIG_MAX_ENTRIES] = {
         CONFIG_DEFAULT_GP_FIX_IMMIGRATION_BUG,
@@ -134,7 +144,12 @@ static int default_values[CONFIG_MAX_ENTRIES] = {
         CONFIG_DEFAULT_GP_CH_RANDOM_COLLAPSES_TAKE_MONEY,
         CONFIG_DEFAULT_GP_CH_MULTIPLE_BARRACKS,
         CONFIG_DEFAULT_GP_CH_WAREHOUSES_DONT_ACCEPT,
-        CONFIG_DEFAULT_GP_CH_HOUSES_DONT_EXPAND_INTO_GARDENS
+        CONFIG_DEFAULT_GP_CH_HOUSES_DONT_EXPAND_INTO_GARDENS,
+        CONFIG_DEFAULT_GP_CH_LIMIT_ROUTES_PER_TICK,
+        CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_MESSAGE,
+        CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_INVASION,
+        CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_REQUEST,
+        CONFIG_DEFAULT_UI_FAST_FORWARD_STOP_ON_POPULATION
 };
 
 static char default_string_values[CONFIG_STRING_MAX_ENTRIES][CONFIG_STRING_VALUE_MAX];
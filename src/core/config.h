@@ -41,6 +41,11 @@ enum {
     CONFIG_GP_CH_MULTIPLE_BARRACKS,
     CONFIG_GP_CH_WAREHOUSES_DONT_ACCEPT,
     CONFIG_GP_CH_HOUSES_DONT_EXPAND_INTO_GARDENS,
+    CONFIG_GP_CH_LIMIT_ROUTES_PER_TICK,
+    CONFIG_UI_FAST_FORWARD_STOP_ON_MESSAGE,
+    CONFIG_UI_FAST_FORWARD_STOP_ON_INVASION,
+    CONFIG_UI_FAST_FORWARD_STOP_ON_REQUEST,
+    CONFIG_UI_FAST_FORWARD_STOP_ON_POPULATION,
     CONFIG_UI_SCROOL_KEEPDELTA,
     CONFIG_MAX_ENTRIES
 };
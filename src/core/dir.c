@@ -5,15 +5,22 @@
 #include "core/string.h"
 #include "platform/file_manager.h"
 
+#include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <unordered_map>
 
 #define BASE_MAX_FILES 100
 
+// directory -> (lower case name -> name on disk), files and subdirectories kept apart
+typedef std::unordered_map<std::string, std::string> dir_case_index;
+static std::unordered_map<std::string, dir_case_index> case_index_cache[2];
+static dir_case_index *index_being_built;
+
 static struct {
     dir_listing listing;
     int max_files;
-    char *cased_filename;
 } data;
 
 static void allocate_listing_files(int min, int max) {
@@ -73,17 +80,43 @@ const dir_listing *dir_find_all_subdirectories(void) {
     return &data.listing;
 }
 
-static int compare_case(const char *filename) {
-    if (string_compare_case_insensitive(filename, data.cased_filename) == 0) {
-        strcpy(data.cased_filename, filename);
-        return LIST_MATCH;
-    }
-    return LIST_NO_MATCH;
+static std::string to_lower_key(const char *name) {
+    std::string key(name);
+    for (size_t i = 0; i < key.size(); i++)
+        key[i] = (char) tolower(key[i]);
+    return key;
+}
+
+static int add_to_case_index(const char *filename) {
+    // keep the first match, like the directory scan it replaces
+    index_being_built->emplace(to_lower_key(filename), filename);
+    return LIST_CONTINUE;
+}
+
+static std::unordered_map<std::string, dir_case_index> &get_case_index_cache(int type) {
+    return case_index_cache[type == TYPE_DIR ? 0 : 1];
+}
+
+static const dir_case_index &get_case_index(const char *dir, int type) {
+    std::unordered_map<std::string, dir_case_index> &cache = get_case_index_cache(type);
+    auto cached = cache.find(dir);
+    if (cached != cache.end())
+        return cached->second;
+
+    dir_case_index &index = cache[dir];
+    index_being_built = &index;
+    platform_file_manager_list_directory_contents(dir, type, 0, add_to_case_index);
+    index_being_built = 0;
+    return index;
 }
 
 static int correct_case(const char *dir, char *filename, int type) {
-    data.cased_filename = filename;
-    return platform_file_manager_list_directory_contents(dir, type, 0, compare_case) == LIST_MATCH;
+    const dir_case_index &index = get_case_index(dir, type);
+    auto match = index.find(to_lower_key(filename));
+    if (match == index.end())
+        return 0;
+    strcpy(filename, match->second.c_str());
+    return 1;
 }
 
 static void move_left(char *str) {
@@ -146,6 +179,22 @@ static const char *get_case_corrected_file(const char *dir, const char *filepath
     return 0;
 }
 
+void dir_invalidate_case_cache(void) {
+    get_case_index_cache(TYPE_DIR).clear();
+    get_case_index_cache(TYPE_FILE).clear();
+}
+
+void dir_invalidate_case_cache_for(const char *filepath) {
+    // only the directory the file is in gains or loses an entry
+    const char *slash = strrchr(filepath, '/');
+    const char *backslash = strrchr(filepath, '\\');
+    if (backslash && (!slash || backslash > slash))
+        slash = backslash;
+    std::string dir = slash ? std::string(filepath, slash - filepath) : std::string(".");
+    get_case_index_cache(TYPE_DIR).erase(dir);
+    get_case_index_cache(TYPE_FILE).erase(dir);
+}
+
 const dir_listing *dir_append_files_with_extension(const char *extension) {
     platform_file_manager_list_directory_contents(0, TYPE_FILE, extension, add_to_listing);
     qsort(data.listing.files, data.listing.num_files, sizeof(char *), compare_lower);
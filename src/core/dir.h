@@ -44,4 +44,16 @@ const dir_listing *dir_find_all_subdirectories(void);
  */
 const char *dir_get_file(const char *filepath, int localizable);
 
+/**
+ * Forgets the cached directory contents used to correct the case of file names.
+ * Needs to be called when files are created or removed outside of file_open/file_remove.
+ */
+void dir_invalidate_case_cache(void);
+
+/**
+ * Forgets the cached contents of the directory a file is created in or removed from
+ * @param filepath Path of the file
+ */
+void dir_invalidate_case_cache_for(const char *filepath);
+
 #endif // CORE_DIR_H
@@ -7,6 +7,7 @@
 #include "core/string.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #define HIGH_CHAR_COUNT 128
 
@@ -419,9 +420,9 @@ static const letter_code HIGH_TO_UTF8_CYRILLIC[HIGH_CHAR_COUNT] = {
 static struct {
     encoding_type encoding;
     const letter_code *to_utf8_table;
-    from_utf8_lookup from_utf8_table[HIGH_CHAR_COUNT];
+    const letter_code *lookup_tables_for;
+    uint8_t internal_for_code_point[ENCODING_CODE_POINT_COUNT];
     from_utf8_lookup from_utf8_decomposed_table[HIGH_CHAR_COUNT];
-    int utf8_table_size;
     int decomposed_table_size;
 } data;
 
@@ -449,17 +450,18 @@ static int compare_utf8_lookup(const void *a, const void *b) {
 }
 
 static void build_reverse_lookup_table(void) {
-    if (!data.to_utf8_table) {
-        data.utf8_table_size = 0;
+    memset(data.internal_for_code_point, 0, sizeof(data.internal_for_code_point));
+    if (!data.to_utf8_table)
         return;
-    }
     for (int i = 0; i < HIGH_CHAR_COUNT; i++) {
         const letter_code *code = &data.to_utf8_table[i];
-        data.from_utf8_table[i].code = code;
-        data.from_utf8_table[i].utf8 = calculate_utf8_value(code->utf8_value, code->bytes);
+        if (code->bytes < 2)
+            continue;
+        int num_bytes;
+        int code_point = encoding_get_utf8_code_point((const char *) code->utf8_value, &num_bytes);
+        if (code_point)
+            data.internal_for_code_point[code_point] = code->internal_value;
     }
-    data.utf8_table_size = HIGH_CHAR_COUNT;
-    qsort(data.from_utf8_table, data.utf8_table_size, sizeof(from_utf8_lookup), compare_utf8_lookup);
 }
 
 static void build_decomposed_lookup_table(void) {
@@ -514,7 +516,7 @@ static int is_combining_char(uint8_t b1, uint8_t b2) {
     return 0;
 }
 
-static const letter_code *search_utf8_table(const from_utf8_lookup *key, const from_utf8_lookup *table, int size) {
+static const letter_code *search_decomposed_table(const from_utf8_lookup *key, const from_utf8_lookup *table, int size) {
     const from_utf8_lookup *result = (from_utf8_lookup *) bsearch(key, table, size, sizeof(from_utf8_lookup),
                                                                   compare_utf8_lookup);
     return result ? result->code : NULL;
@@ -522,7 +524,6 @@ static const letter_code *search_utf8_table(const from_utf8_lookup *key, const f
 
 static const letter_code *get_letter_code_for_utf8(const char *c, int *num_bytes, int *is_accent) {
     static letter_code single_char = {0, 1};
-    from_utf8_lookup key = {0, NULL};
     if (is_accent) *is_accent = 0;
     const uint8_t *uc = (const uint8_t *) c;
 
@@ -531,25 +532,19 @@ static const letter_code *get_letter_code_for_utf8(const char *c, int *num_bytes
         single_char.internal_value = uc[0];
         single_char.utf8_value[0] = uc[0];
         return &single_char;
-    } else if ((uc[0] & 0xe0) == 0xc0 && (uc[1] & 0xc0) == 0x80) {
-        // 2-byte character
-        if (num_bytes) *num_bytes = 2;
-        key.utf8 = uc[0] | uc[1] << 8;
-        if (is_combining_char(uc[0], uc[1])) {
-            if (is_accent) *is_accent = 1;
-            return NULL;
-        }
-    } else if ((uc[0] & 0xf0) == 0xe0 && (uc[1] & 0xc0) == 0x80 && (uc[2] & 0xc0) == 0x80) {
-        // 3-byte character
-        if (num_bytes) *num_bytes = 3;
-        key.utf8 = uc[0] | uc[1] << 8 | uc[2] << 16;
-    } else {
-        if (num_bytes) *num_bytes = 1;
     }
-    if (key.utf8 == 0)
+    int bytes;
+    int code_point = encoding_get_utf8_code_point(c, &bytes);
+    if (num_bytes) *num_bytes = bytes;
+    if (bytes == 2 && is_combining_char(uc[0], uc[1])) {
+        if (is_accent) *is_accent = 1;
+        return NULL;
+    }
+    uint8_t internal_value = data.internal_for_code_point[code_point];
+    if (!internal_value)
         return NULL;
 
-    return search_utf8_table(&key, data.from_utf8_table, data.utf8_table_size);
+    return &data.to_utf8_table[internal_value - 0x80];
 }
 
 static const letter_code *get_letter_code_for_combining_utf8(const char *prev_char, const char *combining_char) {
@@ -569,7 +564,7 @@ static const letter_code *get_letter_code_for_combining_utf8(const char *prev_ch
     code |= prev_code;
 
     from_utf8_lookup key = {code};
-    return search_utf8_table(&key, data.from_utf8_decomposed_table, data.decomposed_table_size);
+    return search_decomposed_table(&key, data.from_utf8_decomposed_table, data.decomposed_table_size);
 }
 
 encoding_type encoding_determine(int language) {
@@ -600,8 +595,11 @@ encoding_type encoding_determine(int language) {
         data.to_utf8_table = HIGH_TO_UTF8_DEFAULT;
         data.encoding = ENCODING_WESTERN_EUROPE;
     }
-    build_reverse_lookup_table();
-    build_decomposed_lookup_table();
+    if (data.lookup_tables_for != data.to_utf8_table) {
+        build_reverse_lookup_table();
+        build_decomposed_lookup_table();
+        data.lookup_tables_for = data.to_utf8_table;
+    }
     return data.encoding;
 }
 
@@ -740,6 +738,25 @@ int encoding_get_utf8_character_bytes(const char input) {
     }
 }
 
+int encoding_get_utf8_code_point(const char *input, int *num_bytes) {
+    const uint8_t *uc = (const uint8_t *) input;
+    *num_bytes = 1;
+    int code_point = 0;
+    if (uc[0] < 0x80) {
+        return uc[0];
+    } else if ((uc[0] & 0xe0) == 0xc0 && (uc[1] & 0xc0) == 0x80) {
+        *num_bytes = 2;
+        code_point = (uc[0] & 0x1f) << 6 | (uc[1] & 0x3f);
+        // overlong forms do not match any character
+        return code_point >= 0x80 ? code_point : 0;
+    } else if ((uc[0] & 0xf0) == 0xe0 && (uc[1] & 0xc0) == 0x80 && (uc[2] & 0xc0) == 0x80) {
+        *num_bytes = 3;
+        code_point = (uc[0] & 0x0f) << 12 | (uc[1] & 0x3f) << 6 | (uc[2] & 0x3f);
+        return code_point >= 0x800 ? code_point : 0;
+    }
+    return 0;
+}
+
 void encoding_utf16_to_utf8(const uint16_t *input, char *output) {
     for (int i = 0; input[i]; i++) {
         if ((input[i] & 0xff80) == 0)
@@ -74,6 +74,17 @@ void encoding_from_utf8(const char *input, uint8_t *output, int output_length);
  */
 int encoding_get_utf8_character_bytes(const char input);
 
+#define ENCODING_CODE_POINT_COUNT 0x10000
+
+/**
+ * Decodes the next utf-8 character, for direct lookups indexed by code point
+ * @param input Input string
+ * @param num_bytes Set to the number of bytes the character takes up, 1 if it is not valid
+ * @return Code point below ENCODING_CODE_POINT_COUNT, or 0 if the character is not a valid
+ *         sequence of one to three bytes
+ */
+int encoding_get_utf8_code_point(const char *input, int *num_bytes);
+
 /**
  * Converts an UTF-16 input input to UTF-8 output
  * @param input Input to convert, encoded using UTF-16
@@ -5,7 +5,6 @@
 #include "core/log.h"
 
 #include <stdlib.h>
-#include <string.h>
 
 typedef struct {
     uint16_t cp949;
@@ -2365,39 +2364,31 @@ static const korean_entry codepage_to_utf8[IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS
         {0xc8fe, {0xed, 0x9e, 0x9d}}
 };
 
-static korean_entry *utf8_to_codepage;
+// index + 1 of the table entry for each Unicode code point, 0 if the character is not in the font
+static uint16_t *code_point_to_index;
 
-static int compare_utf8(const void *a, const void *b) {
-    const uint8_t *va = ((const korean_entry *) a)->utf8;
-    const uint8_t *vb = ((const korean_entry *) b)->utf8;
-    for (int i = 0; i < 3; i++) {
-        if (va[i] == vb[i])
-            continue;
-
-        return va[i] < vb[i] ? -1 : 1;
-    }
-    return 0;
-}
-
-static int compare_codepage(const void *a, const void *b) {
-    uint16_t va = ((const korean_entry *) a)->cp949;
-    uint16_t vb = ((const korean_entry *) b)->cp949;
-    return va == vb ? 0 : (va < vb ? -1 : 1);
+// the table is the complete Hangul block of CP949: rows 0xb0-0xc8 of 94 characters from 0xa1
+static const korean_entry *get_entry_for_codepage(uint8_t high, uint8_t low) {
+    if (high < 0xb0 || low < 0xa1 || low > 0xfe)
+        return NULL;
+    int index = (high - 0xb0) * 94 + low - 0xa1;
+    return index < IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS ? &codepage_to_utf8[index] : NULL;
 }
 
 void encoding_korean_init(void) {
-    if (!utf8_to_codepage) {
-        utf8_to_codepage = (korean_entry *) malloc(sizeof(korean_entry) * IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS);
-        if (!utf8_to_codepage) {
-            log_error("Unable to allocate memory for Korean codepage", 0, 0);
-            return;
-        }
+    if (code_point_to_index)
+        return;
+    code_point_to_index = (uint16_t *) calloc(ENCODING_CODE_POINT_COUNT, sizeof(uint16_t));
+    if (!code_point_to_index) {
+        log_error("Unable to allocate memory for Korean codepage", 0, 0);
+        return;
+    }
+    for (int i = 0; i < IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS; i++) {
+        int num_bytes;
+        int code_point = encoding_get_utf8_code_point((const char *) codepage_to_utf8[i].utf8, &num_bytes);
+        if (code_point)
+            code_point_to_index[code_point] = i + 1;
     }
-    // codepage_to_unicode is already sorted, copy data and sort the other way around
-    memcpy(utf8_to_codepage, codepage_to_utf8,
-           IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS * sizeof(korean_entry));
-
-    qsort(utf8_to_codepage, IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS, sizeof(korean_entry), compare_utf8);
 }
 
 void encoding_korean_to_utf8(const uint8_t *input, char *output, int output_length) {
@@ -2410,10 +2401,7 @@ void encoding_korean_to_utf8(const uint8_t *input, char *output, int output_leng
             ++input;
         } else {
             // multi-byte char
-            const korean_entry key = {input[0] << 8 | input[1]};
-            const korean_entry *entry = (korean_entry *) bsearch(&key, codepage_to_utf8,
-                                                                 IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS,
-                                                                 sizeof(korean_entry), compare_codepage);
+            const korean_entry *entry = get_entry_for_codepage(input[0], input[1]);
             if (entry && output + 3 <= max_output) {
                 for (int i = 0; i < 3; i++) {
                     *output = entry->utf8[i];
@@ -2427,7 +2415,7 @@ void encoding_korean_to_utf8(const uint8_t *input, char *output, int output_leng
 }
 
 void encoding_korean_from_utf8(const char *input, uint8_t *output, int output_length) {
-    if (!utf8_to_codepage) {
+    if (!code_point_to_index) {
         output[0] = 0;
         return;
     }
@@ -2440,16 +2428,15 @@ void encoding_korean_from_utf8(const char *input, uint8_t *output, int output_le
             ++input;
         } else {
             // multi-byte char: Korean characters are always 3 bytes in utf-8
-            const korean_entry key = {0, {(uint8_t) input[0], (uint8_t) input[1], (uint8_t) input[2]}};
-            const korean_entry *entry = (korean_entry *) bsearch(&key, utf8_to_codepage,
-                                                                 IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS,
-                                                                 sizeof(korean_entry), compare_utf8);
-            if (entry && output + 2 <= max_output) {
+            int num_bytes;
+            int index = code_point_to_index[encoding_get_utf8_code_point(input, &num_bytes)];
+            if (index && output + 2 <= max_output) {
+                const korean_entry *entry = &codepage_to_utf8[index - 1];
                 *output = (entry->cp949 >> 8) & 0xff;
                 output++;
                 *output = entry->cp949 & 0xff;
                 output++;
-                input += 3;
+                input += num_bytes;
             } else {
                 *output = '?';
                 output++;
@@ -5,7 +5,6 @@
 #include "core/log.h"
 
 #include <stdlib.h>
-#include <string.h>
 
 typedef struct {
     uint16_t internal;
@@ -2145,39 +2144,32 @@ static const chinese_entry codepage_to_utf8[IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MA
         {0x90d1, {0xe5, 0x87, 0xb8}},
 };
 
-static chinese_entry *utf8_to_codepage;
+// index + 1 of the table entry for each Unicode code point, 0 if the character is not in the font
+static uint16_t *code_point_to_index;
 
-static int compare_utf8(const void *a, const void *b) {
-    const uint8_t *va = ((const chinese_entry *) a)->utf8;
-    const uint8_t *vb = ((const chinese_entry *) b)->utf8;
-    for (int i = 0; i < 3; i++) {
-        if (va[i] != vb[i])
-            return va[i] < vb[i] ? -1 : 1;
-
-    }
-    return 0;
-}
-
-static int compare_internal(const void *a, const void *b) {
-    uint16_t va = ((const chinese_entry *) a)->internal;
-    uint16_t vb = ((const chinese_entry *) b)->internal;
-    return va == vb ? 0 : (va < vb ? -1 : 1);
+// internal codes number the table entries: low byte first, both bytes counting from 0x80
+static const chinese_entry *get_entry_for_internal(uint8_t low, uint8_t high) {
+    if (low < 0x80 || high < 0x80)
+        return NULL;
+    int index = (high - 0x80) * 0x80 + low - 0x80;
+    return index < IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS ? &codepage_to_utf8[index] : NULL;
 }
 
 void encoding_simp_chinese_init(void) {
-    if (!utf8_to_codepage) {
-        utf8_to_codepage = (chinese_entry *) malloc(
-                sizeof(chinese_entry) * IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS);
-        if (!utf8_to_codepage) {
-            log_error("Unable to allocate memory for Chinese codepage", 0, 0);
-            return;
-        }
+    if (code_point_to_index)
+        return;
+    code_point_to_index = (uint16_t *) calloc(ENCODING_CODE_POINT_COUNT, sizeof(uint16_t));
+    if (!code_point_to_index) {
+        log_error("Unable to allocate memory for Chinese codepage", 0, 0);
+        return;
+    }
+    // a character listed twice maps to its last entry
+    for (int i = 0; i < IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS; i++) {
+        int num_bytes;
+        int code_point = encoding_get_utf8_code_point((const char *) codepage_to_utf8[i].utf8, &num_bytes);
+        if (code_point)
+            code_point_to_index[code_point] = i + 1;
     }
-    // codepage_to_utf8 is already sorted, copy data and sort the other way around
-    memcpy(utf8_to_codepage, codepage_to_utf8,
-           IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS * sizeof(chinese_entry));
-
-    qsort(utf8_to_codepage, IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS, sizeof(chinese_entry), compare_utf8);
 }
 
 void encoding_simp_chinese_to_utf8(const uint8_t *input, char *output, int output_length) {
@@ -2190,10 +2182,7 @@ void encoding_simp_chinese_to_utf8(const uint8_t *input, char *output, int outpu
             ++input;
         } else {
             // multi-byte char
-            const chinese_entry key = {input[1] << 8 | input[0]};
-            const chinese_entry *entry = (chinese_entry *) bsearch(&key, codepage_to_utf8,
-                                                                   IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS,
-                                                                   sizeof(chinese_entry), compare_internal);
+            const chinese_entry *entry = get_entry_for_internal(input[0], input[1]);
             if (entry && output + 3 <= max_output) {
                 for (int i = 0; i < 3; i++) {
                     *output = entry->utf8[i];
@@ -2207,7 +2196,7 @@ void encoding_simp_chinese_to_utf8(const uint8_t *input, char *output, int outpu
 }
 
 void encoding_simp_chinese_from_utf8(const char *input, uint8_t *output, int output_length) {
-    if (!utf8_to_codepage) {
+    if (!code_point_to_index) {
         output[0] = 0;
         return;
     }
@@ -2220,16 +2209,15 @@ void encoding_simp_chinese_from_utf8(const char *input, uint8_t *output, int out
             ++input;
         } else {
             // multi-byte char: Chinese characters from the table are always 3 bytes in UTF-8
-            const chinese_entry key = {0, {(uint8_t) input[0], (uint8_t) input[1], (uint8_t) input[2]}};
-            const chinese_entry *entry = (chinese_entry *) bsearch(&key, utf8_to_codepage,
-                                                                   IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS,
-                                                                   sizeof(chinese_entry), compare_utf8);
-            if (entry && output + 2 <= max_output) {
+            int num_bytes;
+            int index = code_point_to_index[encoding_get_utf8_code_point(input, &num_bytes)];
+            if (index && output + 2 <= max_output) {
+                const chinese_entry *entry = &codepage_to_utf8[index - 1];
                 *output = entry->internal & 0xff;
                 output++;
                 *output = (entry->internal >> 8) & 0xff;
                 output++;
-                input += 3;
+                input += num_bytes;
             } else {
                 *output = '?';
                 output++;
@@ -3,7 +3,11 @@
 #include "core/string.h"
 #include "platform/file_manager.h"
 
+#include <string.h>
+
 FILE *file_open(const char *filename, const char *mode) {
+    if (strchr(mode, 'w') || strchr(mode, 'a'))
+        dir_invalidate_case_cache_for(filename);
     return platform_file_manager_open_file(filename, mode);
 }
 
@@ -64,5 +68,6 @@ int file_exists(const char *filename, int localizable) {
 }
 
 int file_remove(const char *filename) {
+    dir_invalidate_case_cache_for(filename);
     return platform_file_manager_remove_file(filename);
 }
@@ -9,6 +9,7 @@
 #include "core/table_translation.h"
 #include "core/image.h"
 #include "core/game_images.h"
+#include "platform/jobs.h"
 
 enum {
     NO_EXTRA_FONT = 0,
@@ -160,11 +161,17 @@ const color_t *image_data_enemy(int id) {
     return game_images::get().image_data_enemy(id);
 }
 
+static void load_collections(int worker, int begin, int end, void *user_data) {
+    auto *collections = (std::vector<image_collection> *) user_data;
+    for (int i = begin; i < end; i++) {
+        collections->at(i).load_files();
+    }
+}
+
 bool game_images::load_main(int climate_id, int is_editor, int force_reload) {
     if (climate_id != current_climate || force_reload) {
-        for (auto &collection : collections) {
-            collection.load_files();
-        }
+        // collections are independent files, decode them side by side
+        platform_jobs_parallel_for_grain((int) collections.size(), 1, load_collections, &collections);
 //        print();
 
         current_climate = climate_id;
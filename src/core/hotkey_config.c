@@ -80,6 +80,9 @@ static const char *ini_keys[] = {
         "resize_to_1024",
         "save_screenshot",
         "save_city_screenshot",
+        "quicksave",
+        "quickload",
+        "toggle_fast_forward",
 };
 
 static struct {
@@ -120,6 +123,7 @@ void init_defaults(void) {
     set_layout_mapping("L", KEY_L, KEY_MOD_NONE, HOTKEY_CYCLE_LEGION);
     set_layout_mapping("[", KEY_LEFTBRACKET, KEY_MOD_NONE, HOTKEY_DECREASE_GAME_SPEED);
     set_layout_mapping("]", KEY_RIGHTBRACKET, KEY_MOD_NONE, HOTKEY_INCREASE_GAME_SPEED);
+    set_layout_mapping("]", KEY_RIGHTBRACKET, KEY_MOD_SHIFT, HOTKEY_TOGGLE_FAST_FORWARD);
     set_mapping(KEY_PAGEDOWN, KEY_MOD_NONE, HOTKEY_DECREASE_GAME_SPEED);
     set_mapping(KEY_PAGEUP, KEY_MOD_NONE, HOTKEY_INCREASE_GAME_SPEED);
     set_mapping(KEY_HOME, KEY_MOD_NONE, HOTKEY_ROTATE_MAP_LEFT);
@@ -176,6 +180,8 @@ void init_defaults(void) {
     set_mapping(KEY_F12, KEY_MOD_NONE, HOTKEY_SAVE_SCREENSHOT);
     set_mapping(KEY_F12, KEY_MOD_ALT, HOTKEY_SAVE_SCREENSHOT); // mac specific
     set_mapping(KEY_F12, KEY_MOD_CTRL, HOTKEY_SAVE_CITY_SCREENSHOT);
+    set_mapping(KEY_F10, KEY_MOD_NONE, HOTKEY_QUICKSAVE);
+    set_mapping(KEY_F11, KEY_MOD_NONE, HOTKEY_QUICKLOAD);
 }
 
 const hotkey_mapping *hotkey_for_action(int action, int index) {
@@ -69,6 +69,9 @@ enum {
     HOTKEY_RESIZE_TO_1024,
     HOTKEY_SAVE_SCREENSHOT,
     HOTKEY_SAVE_CITY_SCREENSHOT,
+    HOTKEY_QUICKSAVE,
+    HOTKEY_QUICKLOAD,
+    HOTKEY_TOGGLE_FAST_FORWARD,
     HOTKEY_MAX_ITEMS
 };
 
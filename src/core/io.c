@@ -3,13 +3,28 @@
 #include <stdio.h>
 
 #include "core/file.h"
+#include "platform/thread.h"
 
-int io_read_file_into_buffer(const char *filepath, int localizable, buffer *buf, int max_size) {
+// dir_get_file() returns a shared buffer and caches directory listings, so resolving a path
+// and opening it is serialized; reading the opened file is not
+static platform_mutex *open_lock;
+
+static FILE *open_for_reading(const char *filepath, int localizable) {
+    if (!open_lock)
+        open_lock = platform_mutex_create();
+    if (open_lock)
+        platform_mutex_lock(open_lock);
+    FILE *fp = 0;
     const char *cased_file = dir_get_file(filepath, localizable);
-    if (!cased_file)
-        return 0;
+    if (cased_file)
+        fp = file_open(cased_file, "rb");
+    if (open_lock)
+        platform_mutex_unlock(open_lock);
+    return fp;
+}
 
-    FILE *fp = file_open(cased_file, "rb");
+int io_read_file_into_buffer(const char *filepath, int localizable, buffer *buf, int max_size) {
+    FILE *fp = open_for_reading(filepath, localizable);
     if (!fp)
         return 0;
 
@@ -24,12 +39,8 @@ int io_read_file_into_buffer(const char *filepath, int localizable, buffer *buf,
     return bytes_read;
 }
 int io_read_file_part_into_buffer(const char *filepath, int localizable, buffer *buf, int size, int offset_in_file) {
-    const char *cased_file = dir_get_file(filepath, localizable);
-    if (!cased_file)
-        return 0;
-
     int bytes_read = 0;
-    FILE *fp = file_open(cased_file, "rb");
+    FILE *fp = open_for_reading(filepath, localizable);
     if (fp) {
         int seek_result = fseek(fp, offset_in_file, SEEK_SET);
         if (seek_result == 0)
@@ -16,6 +16,7 @@
 #define MAX_TEXT_DATA 300000
 #define MIN_TEXT_SIZE (28 + MAX_TEXT_ENTRIES * 8)
 #define MAX_TEXT_SIZE (MIN_TEXT_SIZE + MAX_TEXT_DATA)
+#define MAX_TEXT_STRINGS 50000
 
 #define MAX_MESSAGE_ENTRIES 500
 //#define MAX_MESSAGE_DATA 460000
@@ -31,6 +32,14 @@ static struct {
         int32_t in_use;
     } text_entries[MAX_TEXT_ENTRIES];
     uint8_t text_data[MAX_TEXT_DATA];
+    int text_size;
+
+    // where each string of a group starts, so lookups do not have to count through the group
+    struct {
+        int first;
+        int count;
+    } text_groups[MAX_TEXT_ENTRIES];
+    int32_t string_offsets[MAX_TEXT_STRINGS];
 
     lang_message message_entries[MAX_MESSAGE_ENTRIES];
     uint8_t message_data[MESSAGE_DATA_SIZE];
@@ -129,6 +138,64 @@ static void parse_MM_file(buffer *buf) {
             break;
     }
 }
+static int compare_group_offset(const void *a, const void *b) {
+    return data.text_entries[*(const int *) a].offset - data.text_entries[*(const int *) b].offset;
+}
+static int index_group(int offset, int end, int first) {
+    // same rules as the lookup: a NUL after a non-printable char does not end a string
+    int count = 0;
+    int pos = offset;
+    uint8_t prev = 0;
+    while (pos < end && first + count < MAX_TEXT_STRINGS) {
+        int start = pos;
+        while (start < data.text_size && data.text_data[start] < ' ') // skip non-printables
+            ++start;
+        if (start >= data.text_size)
+            break;
+        data.string_offsets[first + count++] = start;
+        while (pos < end && (data.text_data[pos] || (prev < ' ' && prev != 0))) {
+            prev = data.text_data[pos];
+            ++pos;
+        }
+        if (pos < end) {
+            prev = data.text_data[pos];
+            ++pos;
+        }
+    }
+    return count;
+}
+static void build_string_index(void) {
+    int groups[MAX_TEXT_ENTRIES];
+    for (int i = 0; i < MAX_TEXT_ENTRIES; i++) {
+        groups[i] = i;
+        data.text_groups[i].first = 0;
+        data.text_groups[i].count = 0;
+    }
+    qsort(groups, MAX_TEXT_ENTRIES, sizeof(int), compare_group_offset);
+
+    int num_strings = 0;
+    for (int i = 0; i < MAX_TEXT_ENTRIES; i++) {
+        int group = groups[i];
+        int offset = data.text_entries[group].offset;
+        if (offset < 0 || offset >= data.text_size)
+            continue;
+        if (i > 0 && data.text_entries[groups[i - 1]].offset == offset) {
+            data.text_groups[group] = data.text_groups[groups[i - 1]];
+            continue;
+        }
+        // a group ends where the next one starts: strings past that are looked up the slow way
+        int end = data.text_size;
+        for (int next = i + 1; next < MAX_TEXT_ENTRIES; next++) {
+            if (data.text_entries[groups[next]].offset > offset) {
+                end = data.text_entries[groups[next]].offset;
+                break;
+            }
+        }
+        data.text_groups[group].first = num_strings;
+        data.text_groups[group].count = index_group(offset, end, num_strings);
+        num_strings += data.text_groups[group].count;
+    }
+}
 static int load_files(const char *text_filename, const char *message_filename, int localizable) {
     // load text into buffer
     buffer buf(BUFFER_SIZE);
@@ -144,7 +211,8 @@ static int load_files(const char *text_filename, const char *message_filename, i
         data.text_entries[i].in_use = buf.read_i32();
 
     }
-    buf.read_raw(data.text_data, filesize - 8028); //MAX_TEXT_DATA
+    data.text_size = buf.read_raw(data.text_data, filesize - 8028); //MAX_TEXT_DATA
+    build_string_index();
 
     // load message
     buf.clear();
@@ -177,6 +245,9 @@ const uint8_t *lang_get_string(int group, int index) {
             return translation_for(TR_BUILDING_ROADBLOCK_DESC);
     }
 
+    if (index >= 0 && index < data.text_groups[group].count)
+        return &data.text_data[data.string_offsets[data.text_groups[group].first + index]];
+
     int32_t string_offset = data.text_entries[group].offset;
     const uint8_t *str = &data.text_data[string_offset];
     uint8_t prev = 0;
@@ -589,6 +589,8 @@ static void setup_mods_folder_string(void) {
 }
 
 void mods_init(void) {
+    // mods may have been added or removed since the file names were last looked up
+    dir_invalidate_case_cache();
     setup_mods_folder_string();
 
     const dir_listing *xml_files = dir_find_files_with_extension(MODS_FOLDER, "xml");
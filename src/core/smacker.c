@@ -30,36 +30,56 @@
 #define BLOCK_VOID 2
 #define BLOCK_SOLID 3
 
+// Bits are read LSB first from a 64-bit window that is refilled a byte at a time.
+// Reads past the end of the data return zeros, like the original bit-by-bit reader.
 typedef struct {
     const uint8_t *data;
     int length;
-    int index;
-    int bit_index;
+    int position;
+    int next_byte;
+    int bits_available;
+    uint64_t bits;
 } bitstream;
 
-typedef struct huffnode8_t {
-    struct huffnode8_t *b[2];
+// Huffman codes are decoded with a table indexed by the next table_bits bits of the stream.
+// Codes that are longer than that continue walking the tree from the node stored in the entry.
+#define TREE8_TABLE_BITS 8
+#define TREE16_TABLE_BITS 11
+#define TREE8_MAX_NODES 512
+
+typedef struct {
+    int b[2];
     int is_leaf;
-    uint8_t value;
-} huffnode8;
+    uint16_t value;
+} huffnode;
+
+typedef struct {
+    uint32_t value;
+    uint8_t length;
+    uint8_t is_leaf;
+} huffentry;
 
-typedef struct hufftree8_t {
-    huffnode8 nodes[512];
+typedef struct {
+    huffnode *nodes;
     int size;
-} hufftree8;
+    int capacity;
+    int max_nodes;
+    huffentry *table;
+    int table_bits;
+} hufftree;
 
-typedef struct huffnode16_t {
-    struct huffnode16_t *b[2];
-    int is_leaf;
-    uint16_t value;
-} huffnode16;
+typedef hufftree hufftree8;
 
 typedef struct hufftree16_t {
-    huffnode16 *root;
+    // leaf values of the tree are slots in values, so that the escape slots can change while decoding
+    hufftree tree;
     hufftree8 *low;
     hufftree8 *high;
+    uint16_t *values;
+    int num_values;
+    int max_values;
     uint16_t escape_codes[3];
-    huffnode16 *escape_nodes[3];
+    int escape_slots[3];
 } hufftree16;
 
 typedef struct {
@@ -93,18 +113,9 @@ struct smacker_t {
 
     frame_data_t frame_data;
     int32_t current_frame;
-};
 
-static const uint8_t BIT_MASKS[] = {
-        0x00,
-        0x01,
-        0x03,
-        0x07,
-        0x0f,
-        0x1f,
-        0x3f,
-        0x7f,
-        0xff,
+    uint8_t *read_buffer;
+    int32_t read_buffer_size;
 };
 
 static const uint8_t PALETTE_MAP[64] = {
@@ -146,56 +157,150 @@ static int32_t read_i32(uint8_t *data) {
 static bitstream *bitstream_init(bitstream *bs, const uint8_t *data, int len) {
     bs->data = data;
     bs->length = len;
-    bs->index = 0;
-    bs->bit_index = 0;
+    bs->position = 0;
+    bs->next_byte = 0;
+    bs->bits_available = 0;
+    bs->bits = 0;
     return bs;
 }
 
+static inline void refill(bitstream *bs) {
+    while (bs->bits_available <= 56) {
+        uint64_t byte = bs->next_byte < bs->length ? bs->data[bs->next_byte] : 0;
+        bs->bits |= byte << bs->bits_available;
+        bs->bits_available += 8;
+        bs->next_byte++;
+    }
+}
+
+static inline void consume(bitstream *bs, int num_bits) {
+    bs->bits >>= num_bits;
+    bs->bits_available -= num_bits;
+    bs->position += num_bits;
+}
+
 static inline int read_bit(bitstream *bs) {
-    if (bs->index >= bs->length)
+    if ((bs->position >> 3) >= bs->length)
         return 0;
 
-    int result = bs->data[bs->index] & (1 << bs->bit_index);
-    if (++bs->bit_index >= 8) {
-        bs->index++;
-        bs->bit_index = 0;
-    }
-    return result ? 1 : 0;
+    if (!bs->bits_available)
+        refill(bs);
+    int result = (int) (bs->bits & 1);
+    consume(bs, 1);
+    return result;
 }
 
 static inline uint8_t read_byte(bitstream *bs) {
-    if (bs->bit_index == 0) {
+    int index = bs->position >> 3;
+    if ((bs->position & 7) == 0) {
         // special case: on exact byte boundary
-        if (bs->index < bs->length)
-            return bs->data[bs->index++];
-        else {
+        if (index >= bs->length)
             return 0;
+    } else if (index + 1 >= bs->length)
+        return 0;
+
+    if (bs->bits_available < 8)
+        refill(bs);
+    uint8_t value = (uint8_t) bs->bits;
+    consume(bs, 8);
+    return value;
+}
+
+// Generic huffman tree functions
+
+static int add_node(hufftree *tree) {
+    if (tree->size >= tree->capacity) {
+        if (tree->max_nodes && tree->capacity >= tree->max_nodes)
+            return -1;
+        int capacity = tree->capacity ? tree->capacity * 2 : 256;
+        huffnode *nodes = (huffnode *) realloc(tree->nodes, sizeof(huffnode) * capacity);
+        if (!nodes)
+            return -1;
+        tree->nodes = nodes;
+        tree->capacity = capacity;
+    }
+    memset(&tree->nodes[tree->size], 0, sizeof(huffnode));
+    return tree->size++;
+}
+
+static void fill_table(hufftree *tree, int node, int depth, uint32_t code) {
+    const huffnode *n = &tree->nodes[node];
+    if (n->is_leaf) {
+        // every index that starts with this code maps to the leaf
+        for (uint32_t rest = 0; rest < (1u << (tree->table_bits - depth)); rest++) {
+            huffentry *entry = &tree->table[code | (rest << depth)];
+            entry->value = n->value;
+            entry->length = depth;
+            entry->is_leaf = 1;
         }
+    } else if (depth == tree->table_bits) {
+        huffentry *entry = &tree->table[code];
+        entry->value = node;
+        entry->length = depth;
+        entry->is_leaf = 0;
+    } else {
+        fill_table(tree, n->b[0], depth + 1, code);
+        fill_table(tree, n->b[1], depth + 1, code | (1u << depth));
     }
-    if (bs->index + 1 >= bs->length)
+}
+
+static int build_table(hufftree *tree) {
+    tree->table = (huffentry *) clear_malloc(sizeof(huffentry) << tree->table_bits);
+    if (!tree->table)
         return 0;
+    fill_table(tree, 0, 0, 0);
+    return 1;
+}
 
-    uint8_t value = bs->data[bs->index] >> bs->bit_index;
-    bs->index++;
-    value |= (bs->data[bs->index] & BIT_MASKS[bs->bit_index]) << (8 - bs->bit_index);
-    return value;
+static inline uint32_t lookup(bitstream *bs, const hufftree *tree) {
+    if (bs->bits_available < tree->table_bits)
+        refill(bs);
+    const huffentry *entry = &tree->table[bs->bits & ((1u << tree->table_bits) - 1)];
+    consume(bs, entry->length);
+    if (entry->is_leaf)
+        return entry->value;
+
+    int node = entry->value;
+    while (!tree->nodes[node].is_leaf) {
+        node = tree->nodes[node].b[read_bit(bs)];
+    }
+    return tree->nodes[node].value;
+}
+
+static void free_tree(hufftree *tree) {
+    free(tree->nodes);
+    free(tree->table);
 }
 
 // 8-bit huffman tree functions
 
-static huffnode8 *build_tree8_nodes(bitstream *bs, hufftree8 *tree) {
-    huffnode8 *node = &tree->nodes[tree->size++];
+static int build_tree8_nodes(bitstream *bs, hufftree8 *tree) {
+    int node = add_node(tree);
+    if (node < 0)
+        return -1;
     if (read_bit(bs)) {
-        node->is_leaf = 0;
-        node->b[0] = build_tree8_nodes(bs, tree);
-        node->b[1] = build_tree8_nodes(bs, tree);
+        int b0 = build_tree8_nodes(bs, tree);
+        if (b0 < 0)
+            return -1;
+        int b1 = build_tree8_nodes(bs, tree);
+        if (b1 < 0)
+            return -1;
+        tree->nodes[node].b[0] = b0;
+        tree->nodes[node].b[1] = b1;
     } else {
-        node->is_leaf = 1;
-        node->value = read_byte(bs);
+        tree->nodes[node].is_leaf = 1;
+        tree->nodes[node].value = read_byte(bs);
     }
     return node;
 }
 
+static void free_tree8(hufftree8 *tree) {
+    if (!tree)
+        return;
+    free_tree(tree);
+    free(tree);
+}
+
 static hufftree8 *create_tree8(bitstream *bs) {
     if (read_bit(bs)) {
         hufftree8 *tree = (hufftree8 *) clear_malloc(sizeof(hufftree8));
@@ -203,10 +308,21 @@ static hufftree8 *create_tree8(bitstream *bs) {
             log_error("SMK: no memory for 8-bit tree", 0, 0);
             return NULL;
         }
-        build_tree8_nodes(bs, tree);
+        tree->table_bits = TREE8_TABLE_BITS;
+        tree->max_nodes = TREE8_MAX_NODES;
+        if (build_tree8_nodes(bs, tree) < 0) {
+            log_error("SMK: 8-bit tree too large", 0, 0);
+            free_tree8(tree);
+            return NULL;
+        }
         if (read_bit(bs) != 0) {
             log_error("SMK: 8-bit tree not closed", 0, 0);
-            free(tree);
+            free_tree8(tree);
+            return NULL;
+        }
+        if (!build_table(tree)) {
+            log_error("SMK: no memory for 8-bit tree table", 0, 0);
+            free_tree8(tree);
             return NULL;
         }
         return tree;
@@ -216,74 +332,65 @@ static hufftree8 *create_tree8(bitstream *bs) {
     }
 }
 
-static void free_tree8(hufftree8 *tree) {
-    free(tree);
-}
-
 static uint8_t lookup_tree8(bitstream *bs, hufftree8 *tree) {
-    huffnode8 *node = &tree->nodes[0];
-    while (!node->is_leaf) {
-        node = node->b[read_bit(bs)];
-    }
-    return node->value;
+    return (uint8_t) lookup(bs, tree);
 }
 
 // 16-bit huffman tree functions
 
-static void free_node16(huffnode16 *node) {
-    if (!node)
-        return;
-    if (!node->is_leaf) {
-        free_node16(node->b[0]);
-        free_node16(node->b[1]);
-    }
-    free(node);
-}
-
 static void free_tree16(hufftree16 *tree) {
     if (!tree)
         return;
-    for (int i = 0; i < 3; i++) {
-        if (!tree->escape_nodes[i]->is_leaf) {
-            // Free manually allocated node because it's not in the tree
-            free(tree->escape_nodes[i]);
-        }
-    }
-    free_node16(tree->root);
+    free_tree(&tree->tree);
+    free(tree->values);
     free_tree8(tree->low);
     free_tree8(tree->high);
     free(tree);
 }
 
-static huffnode16 *build_tree16_nodes(bitstream *bs, hufftree16 *tree) {
-    huffnode16 *node = (huffnode16 *) clear_malloc(sizeof(huffnode16));
-    if (!node) {
+static int add_value(hufftree16 *tree, uint16_t value) {
+    if (tree->num_values >= tree->max_values) {
+        int max_values = tree->max_values ? tree->max_values * 2 : 256;
+        uint16_t *values = (uint16_t *) realloc(tree->values, sizeof(uint16_t) * max_values);
+        if (!values)
+            return -1;
+        tree->values = values;
+        tree->max_values = max_values;
+    }
+    tree->values[tree->num_values] = value;
+    return tree->num_values++;
+}
+
+static int build_tree16_nodes(bitstream *bs, hufftree16 *tree) {
+    int node = add_node(&tree->tree);
+    if (node < 0) {
         log_error("SMK: no memory for 16-bit tree node", 0, 0);
-        return NULL;
+        return -1;
     }
     if (read_bit(bs)) {
-        node->is_leaf = 0;
-        node->b[0] = build_tree16_nodes(bs, tree);
-        if (!node->b[0]) {
-            free(node);
-            return NULL;
-        }
-        node->b[1] = build_tree16_nodes(bs, tree);
-        if (!node->b[1]) {
-            free_node16(node->b[0]);
-            free(node);
-            return NULL;
-        }
+        int b0 = build_tree16_nodes(bs, tree);
+        if (b0 < 0)
+            return -1;
+        int b1 = build_tree16_nodes(bs, tree);
+        if (b1 < 0)
+            return -1;
+        tree->tree.nodes[node].b[0] = b0;
+        tree->tree.nodes[node].b[1] = b1;
     } else {
-        node->is_leaf = 1;
         uint8_t lo_val = lookup_tree8(bs, tree->low);
         uint8_t hi_val = lookup_tree8(bs, tree->high);
         uint16_t leaf_value = lo_val | (hi_val << 8);
-        node->value = leaf_value;
+        int slot = add_value(tree, leaf_value);
+        if (slot < 0 || slot > UINT16_MAX) {
+            log_error("SMK: no memory for 16-bit tree value", 0, 0);
+            return -1;
+        }
+        tree->tree.nodes[node].is_leaf = 1;
+        tree->tree.nodes[node].value = slot;
 
         for (int i = 0; i < 3; i++) {
             if (leaf_value == tree->escape_codes[i])
-                tree->escape_nodes[i] = node;
+                tree->escape_slots[i] = slot;
 
         }
     }
@@ -296,16 +403,17 @@ static hufftree16 *create_tree16(bitstream *bs, hufftree8 *low, hufftree8 *high)
         log_error("SMK: no memory for 16-bit tree", 0, 0);
         return NULL;
     }
+    tree->tree.table_bits = TREE16_TABLE_BITS;
     tree->low = low;
     tree->high = high;
     for (int i = 0; i < 3; i++) {
         // Do not join the following two lines as it results in an optimization bug for MSVC. See PR #215
         tree->escape_codes[i] = read_byte(bs);
         tree->escape_codes[i] |= read_byte(bs) << 8;
+        tree->escape_slots[i] = -1;
     }
-    tree->root = build_tree16_nodes(bs, tree);
-    if (!tree->root) {
-        free(tree);
+    if (build_tree16_nodes(bs, tree) < 0) {
+        free_tree16(tree);
         return NULL;
     }
     if (read_bit(bs) != 0) {
@@ -314,20 +422,28 @@ static hufftree16 *create_tree16(bitstream *bs, hufftree8 *low, hufftree8 *high)
         return NULL;
     }
     for (int i = 0; i < 3; i++) {
-        if (!tree->escape_nodes[i]) {
-            // Escape node is not in the tree: create a dummy node
-            tree->escape_nodes[i] = (huffnode16 *) clear_malloc(sizeof(huffnode16));
-            tree->escape_nodes[i]->is_leaf = 0;
-            tree->escape_nodes[i]->value = 0;
+        if (tree->escape_slots[i] < 0) {
+            // Escape code is not in the tree: give it a slot that no code decodes to
+            tree->escape_slots[i] = add_value(tree, 0);
+            if (tree->escape_slots[i] < 0) {
+                log_error("SMK: no memory for 16-bit tree value", 0, 0);
+                free_tree16(tree);
+                return NULL;
+            }
         }
     }
+    if (!build_table(&tree->tree)) {
+        log_error("SMK: no memory for 16-bit tree table", 0, 0);
+        free_tree16(tree);
+        return NULL;
+    }
     return tree;
 }
 
 static void reset_escape16(hufftree16 *tree) {
     if (tree) {
         for (int i = 0; i < 3; i++) {
-            tree->escape_nodes[i]->value = 0;
+            tree->values[tree->escape_slots[i]] = 0;
         }
     }
 }
@@ -336,16 +452,13 @@ static uint16_t lookup_tree16(bitstream *bs, hufftree16 *tree) {
     if (!tree)
         return 0;
 
-    huffnode16 *node = tree->root;
-    while (!node->is_leaf) {
-        node = node->b[read_bit(bs)];
-    }
-
-    uint16_t value = node->value;
-    if (value != tree->escape_nodes[0]->value) {
-        tree->escape_nodes[2]->value = tree->escape_nodes[1]->value;
-        tree->escape_nodes[1]->value = tree->escape_nodes[0]->value;
-        tree->escape_nodes[0]->value = value;
+    uint16_t *values = tree->values;
+    const int *escape = tree->escape_slots;
+    uint16_t value = values[lookup(bs, &tree->tree)];
+    if (value != values[escape[0]]) {
+        values[escape[2]] = values[escape[1]];
+        values[escape[1]] = values[escape[0]];
+        values[escape[0]] = value;
     }
     return value;
 }
@@ -526,6 +639,7 @@ void smacker_close(smacker s) {
         free(s->frame_data.audio[i]);
     }
     free(s->frame_data.video);
+    free(s->read_buffer);
     free(s);
 }
 
@@ -778,21 +892,21 @@ static uint8_t *read_frame_data(smacker s, int frame_id) {
         return NULL;
     }
     int frame_size = s->frame_sizes[frame_id];
-    uint8_t *frame_data = (uint8_t *) clear_malloc(frame_size);
-    if (!frame_data) {
-        log_error("SMK: no memory for frame data", 0, frame_id);
-        return NULL;
+    // the read buffer is kept between frames and only grows
+    if (frame_size > s->read_buffer_size) {
+        uint8_t *buffer = (uint8_t *) realloc(s->read_buffer, frame_size);
+        if (!buffer) {
+            log_error("SMK: no memory for frame data", 0, frame_id);
+            return NULL;
+        }
+        s->read_buffer = buffer;
+        s->read_buffer_size = frame_size;
     }
-    if (fread(frame_data, 1, frame_size, s->fp) != frame_size) {
+    if (fread(s->read_buffer, 1, frame_size, s->fp) != frame_size) {
         log_error("SMK: unable to read data for frame", 0, frame_id);
-        free(frame_data);
         return NULL;
     }
-    return frame_data;
-}
-
-static void free_frame_data(const smacker s, uint8_t *frame_data) {
-    free(frame_data);
+    return s->read_buffer;
 }
 
 static smacker_frame_status decode_frame(smacker s) {
@@ -810,10 +924,9 @@ static smacker_frame_status decode_frame(smacker s) {
     int data_index = 0;
     if (frame_type & 0x01) {
         int palette_size = frame_data[0] * 4;
-        if (!decode_palette(s, &frame_data[1], palette_size - 1)) {
-            free_frame_data(s, frame_data);
+        if (!decode_palette(s, &frame_data[1], palette_size - 1))
             return SMACKER_FRAME_ERROR;
-        }
+
         data_index += palette_size;
     }
     for (int i = 0; i < MAX_TRACKS; i++) {
@@ -825,12 +938,9 @@ static smacker_frame_status decode_frame(smacker s) {
             s->frame_data.audio_len[i] = 0;
         }
     }
-    if (!decode_video(s, &frame_data[data_index], s->frame_sizes[frame_id] - data_index)) {
-        free_frame_data(s, frame_data);
+    if (!decode_video(s, &frame_data[data_index], s->frame_sizes[frame_id] - data_index))
         return SMACKER_FRAME_ERROR;
-    }
 
-    free_frame_data(s, frame_data);
     return SMACKER_FRAME_OK;
 }
 
@@ -1,4 +1,5 @@
 #include <cmath>
+#include <string.h>
 #include "action.h"
 
 #include "city/entertainment.h"
@@ -482,10 +483,75 @@ void figure::action_perform() {
     }
 }
 
+#define LIVE_WORDS ((MAX_FIGURES_CAPACITY + 63) / 64)
+
+// Bitset of figure slots that may be alive. Iterating it in id order visits the same figures
+// in the same order as walking every slot: figures created during the tick in a higher slot
+// are still updated in that tick, ones created in a lower slot are not.
+static struct {
+    uint64_t live[LIVE_WORDS];
+    int needs_rebuild;
+    int route_budget;
+    int routes_left;
+} schedule = {{0}, 1, 0, 0};
+
+void figure_action_mark_live(int figure_id) {
+    if (figure_id > 0 && figure_id < LIVE_WORDS * 64)
+        schedule.live[figure_id / 64] |= (uint64_t) 1 << (figure_id % 64);
+}
+void figure_action_reset_schedule(void) {
+    schedule.needs_rebuild = 1;
+}
+void figure_action_set_route_budget(int routes_per_tick) {
+    schedule.route_budget = routes_per_tick > 0 ? routes_per_tick : 0;
+}
+int figure_action_take_route_budget(void) {
+    if (!schedule.route_budget)
+        return 1;
+    if (schedule.routes_left <= 0)
+        return 0;
+    schedule.routes_left--;
+    return 1;
+}
+static void rebuild_live_list(void) {
+    memset(schedule.live, 0, sizeof(schedule.live));
+    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
+        if (figure_get(i)->state)
+            figure_action_mark_live(i);
+    }
+    schedule.needs_rebuild = 0;
+}
+static int next_live_figure(int from, int max_id) {
+    while (from < max_id) {
+        int word = from / 64;
+        uint64_t bits = schedule.live[word] >> (from % 64);
+        if (bits) {
+            while (!(bits & 1)) {
+                bits >>= 1;
+                from++;
+            }
+            return from < max_id ? from : 0;
+        }
+        from = (word + 1) * 64;
+    }
+    return 0;
+}
+
 void figure_action_handle(void) {
 //    return;
     city_figures_reset();
     city_entertainment_set_hippodrome_has_race(0);
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++)
-        figure_get(i)->action_perform();
+    if (schedule.needs_rebuild)
+        rebuild_live_list();
+    schedule.routes_left = schedule.route_budget;
+    int max_id = MAX_FIGURES[get_game_engine()];
+    if (max_id > LIVE_WORDS * 64)
+        max_id = LIVE_WORDS * 64;
+    for (int i = next_live_figure(1, max_id); i; i = next_live_figure(i + 1, max_id)) {
+        figure *f = figure_get(i);
+        if (f->state)
+            f->action_perform();
+        if (!f->state)
+            schedule.live[i / 64] &= ~((uint64_t) 1 << (i % 64));
+    }
 }
@@ -297,4 +297,31 @@ static int actionid_translation_table_ph[] {
 
 void figure_action_handle(void);
 
+/**
+ * Adds a newly created figure to the list of figures updated each tick
+ * @param figure_id Figure ID
+ */
+void figure_action_mark_live(int figure_id);
+
+/**
+ * Rebuilds the list of live figures from the figure array, call after the figures were
+ * replaced wholesale (new scenario, loaded game)
+ */
+void figure_action_reset_schedule(void);
+
+/**
+ * Limits the number of new routes to a destination computed per tick, figures that exceed
+ * the budget wait on their tile and try again on the next tick. Roaming walkers are not
+ * limited. Set before every tick from the route limit setting.
+ * With 0 (no limit, the default) the simulation is identical to an unscheduled one.
+ * @param routes_per_tick Maximum number of routes, 0 for no limit
+ */
+void figure_action_set_route_budget(int routes_per_tick);
+
+/**
+ * Takes one route computation from this tick's budget
+ * @return 1 if the route may be computed now, 0 if it has to wait
+ */
+int figure_action_take_route_budget(void);
+
 #endif // FIGURE_ACTION_H
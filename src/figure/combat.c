@@ -25,188 +25,234 @@ int attack_is_same_direction(int dir1, int dir2) {
     return 0;
 }
 
-int figure_combat_get_target_for_soldier(int x, int y, int max_distance) {
-    int figure_id = 0;
-    int min_distance = 10000;
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
-        figure *f = figure_get(i);
-        if (f->is_dead())
-            continue;
+#define SEARCH_WHOLE_MAP 1000
+
+typedef struct {
+    int x;
+    int y;
+    int max_distance;
+    int attack_citizens;
+    int best_distance;
+    int best_id;
+} target_search;
+
+static void init_search(target_search *search, int x, int y, int max_distance) {
+    search->x = x;
+    search->y = y;
+    search->max_distance = max_distance;
+    search->attack_citizens = 0;
+    search->best_distance = 10000;
+    search->best_id = 0;
+}
+// the original scans went through figures by id and kept the first one with the
+// lowest distance, so ties are broken by id to keep the same target
+static int is_better_target(const target_search *search, int distance, int figure_id) {
+    if (distance != search->best_distance)
+        return distance < search->best_distance;
+    return !search->best_id || figure_id < search->best_id;
+}
+static void keep_lowest_id(target_search *search, int figure_id) {
+    if (!search->best_id || figure_id < search->best_id)
+        search->best_id = figure_id;
+}
 
-        if (f->is_enemy() || f->type == FIGURE_RIOTER || f->is_attacking_native()) {
-            int distance = calc_maximum_distance(x, y, f->tile_x, f->tile_y);
-            if (distance <= max_distance) {
-                if (f->targeted_by_figure_id)
-                    distance *= 2; // penalty
+static int is_soldier_target(figure *f) {
+    return !f->is_dead() && (f->is_enemy() || f->type == FIGURE_RIOTER || f->is_attacking_native());
+}
+static void check_soldier_target(figure *f, void *user_data) {
+    target_search *search = (target_search *) user_data;
+    if (!is_soldier_target(f))
+        return;
+    int distance = calc_maximum_distance(search->x, search->y, f->tile_x, f->tile_y);
+    if (distance > search->max_distance)
+        return;
+    if (f->targeted_by_figure_id)
+        distance *= 2; // penalty
 
-                if (distance < min_distance) {
-                    min_distance = distance;
-                    figure_id = i;
-                }
-            }
-        }
+    if (is_better_target(search, distance, f->id)) {
+        search->best_distance = distance;
+        search->best_id = f->id;
     }
-    if (figure_id)
-        return figure_id;
-
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
-        figure *f = figure_get(i);
-        if (f->is_dead())
-            continue;
-
-        if (f->is_enemy() || f->type == FIGURE_RIOTER || f->is_attacking_native())
-            return i;
+}
+static void first_soldier_target(figure *f, void *user_data) {
+    if (is_soldier_target(f))
+        keep_lowest_id((target_search *) user_data, f->id);
+}
+int figure_combat_get_target_for_soldier(int x, int y, int max_distance) {
+    const int classes = FIGURE_INDEX_MASK(FIGURE_INDEX_ENEMY) | FIGURE_INDEX_MASK(FIGURE_INDEX_CITIZEN);
+    target_search search;
+    init_search(&search, x, y, max_distance);
+    map_figure_foreach_in_radius(x, y, max_distance, classes, check_soldier_target, &search);
+    if (search.best_id)
+        return search.best_id;
+
+    init_search(&search, x, y, SEARCH_WHOLE_MAP);
+    map_figure_foreach_in_radius(x, y, SEARCH_WHOLE_MAP, classes, first_soldier_target, &search);
+    return search.best_id;
+}
 
+static void check_wolf_target(figure *f, void *user_data) {
+    target_search *search = (target_search *) user_data;
+    if (f->is_dead() || !f->type) {
+        return;
+    }
+    switch (f->type) {
+        case FIGURE_EXPLOSION:
+        case FIGURE_FORT_STANDARD:
+        case FIGURE_TRADE_SHIP:
+        case FIGURE_FISHING_BOAT:
+        case FIGURE_MAP_FLAG:
+        case FIGURE_FLOTSAM:
+        case FIGURE_SHIPWRECK:
+        case FIGURE_INDIGENOUS_NATIVE:
+        case FIGURE_TOWER_SENTRY:
+        case FIGURE_NATIVE_TRADER:
+        case FIGURE_ARROW:
+        case FIGURE_JAVELIN:
+        case FIGURE_BOLT:
+        case FIGURE_BALLISTA:
+        case FIGURE_CREATURE:
+            return;
+    }
+    if (f->is_enemy() || f->is_herd()) {
+        return;
+    }
+    if (f->is_legion() && f->action_state == FIGURE_ACTION_80_SOLDIER_AT_REST) {
+        return;
+    }
+    int distance = calc_maximum_distance(search->x, search->y, f->tile_x, f->tile_y);
+    if (f->targeted_by_figure_id) {
+        distance *= 2;
+    }
+    if (is_better_target(search, distance, f->id)) {
+        search->best_distance = distance;
+        search->best_id = f->id;
     }
-    return 0;
 }
 int figure_combat_get_target_for_wolf(int x, int y, int max_distance) {
-    int min_figure_id = 0;
-    int min_distance = 10000;
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
-        figure *f = figure_get(i);
-        if (f->is_dead() || !f->type) {
-            continue;
-        }
-        switch (f->type) {
-            case FIGURE_EXPLOSION:
-            case FIGURE_FORT_STANDARD:
-            case FIGURE_TRADE_SHIP:
-            case FIGURE_FISHING_BOAT:
-            case FIGURE_MAP_FLAG:
-            case FIGURE_FLOTSAM:
-            case FIGURE_SHIPWRECK:
-            case FIGURE_INDIGENOUS_NATIVE:
-            case FIGURE_TOWER_SENTRY:
-            case FIGURE_NATIVE_TRADER:
-            case FIGURE_ARROW:
-            case FIGURE_JAVELIN:
-            case FIGURE_BOLT:
-            case FIGURE_BALLISTA:
-            case FIGURE_CREATURE:
-                continue;
-        }
-        if (f->is_enemy() || f->is_herd()) {
-            continue;
-        }
-        if (f->is_legion() && f->action_state == FIGURE_ACTION_80_SOLDIER_AT_REST) {
-            continue;
-        }
-        int distance = calc_maximum_distance(x, y, f->tile_x, f->tile_y);
-        if (f->targeted_by_figure_id) {
-            distance *= 2;
-        }
-        if (distance < min_distance) {
-            min_distance = distance;
-            min_figure_id = i;
-        }
-    }
-    if (min_distance <= max_distance && min_figure_id) {
-        return min_figure_id;
+    // anything further away than max_distance can never be chosen
+    target_search search;
+    init_search(&search, x, y, max_distance);
+    map_figure_foreach_in_radius(x, y, max_distance,
+                                 FIGURE_INDEX_MASK(FIGURE_INDEX_CITIZEN) | FIGURE_INDEX_MASK(FIGURE_INDEX_SOLDIER),
+                                 check_wolf_target, &search);
+    if (search.best_distance <= max_distance && search.best_id) {
+        return search.best_id;
     }
     return 0;
 }
-int figure_combat_get_target_for_enemy(int x, int y) {
-    int min_figure_id = 0;
-    int min_distance = 10000;
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
-        figure *f = figure_get(i);
-        if (f->is_dead())
-            continue;
 
-        if (!f->targeted_by_figure_id && f->is_legion()) {
-            int distance = calc_maximum_distance(x, y, f->tile_x, f->tile_y);
-            if (distance < min_distance) {
-                min_distance = distance;
-                min_figure_id = i;
-            }
-        }
+static void check_enemy_target(figure *f, void *user_data) {
+    target_search *search = (target_search *) user_data;
+    if (f->is_dead() || f->targeted_by_figure_id || !f->is_legion())
+        return;
+
+    int distance = calc_maximum_distance(search->x, search->y, f->tile_x, f->tile_y);
+    if (is_better_target(search, distance, f->id)) {
+        search->best_distance = distance;
+        search->best_id = f->id;
+    }
+}
+static void first_enemy_target(figure *f, void *user_data) {
+    if (!f->is_dead() && f->is_legion())
+        keep_lowest_id((target_search *) user_data, f->id);
+}
+int figure_combat_get_target_for_enemy(int x, int y) {
+    const int classes = FIGURE_INDEX_MASK(FIGURE_INDEX_SOLDIER);
+    target_search search;
+    // widen the search until the closest soldier found lies within the searched radius
+    for (int radius = 8; radius < 2 * SEARCH_WHOLE_MAP; radius *= 2) {
+        init_search(&search, x, y, radius);
+        map_figure_foreach_in_radius(x, y, radius, classes, check_enemy_target, &search);
+        if (search.best_id && search.best_distance <= radius)
+            return search.best_id;
     }
-    if (min_figure_id)
-        return min_figure_id;
 
     // no 'free' soldier found, take first one
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
-        figure *f = figure_get(i);
-        if (f->is_dead())
-            continue;
-
-        if (f->is_legion())
-            return i;
+    init_search(&search, x, y, SEARCH_WHOLE_MAP);
+    map_figure_foreach_in_radius(x, y, SEARCH_WHOLE_MAP, classes, first_enemy_target, &search);
+    return search.best_id;
+}
 
-    }
-    return 0;
+static void first_missile_target_for_soldier(figure *f, void *user_data) {
+    if (!f->is_dead() && (f->is_enemy() || f->is_herd() || f->is_attacking_native()))
+        keep_lowest_id((target_search *) user_data, f->id);
 }
 int figure_combat_get_missile_target_for_soldier(figure *shooter, int max_distance, map_point *tile) {
     int x = shooter->tile_x;
     int y = shooter->tile_y;
 
-    int min_distance = max_distance;
-    figure *min_figure = 0;
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
-        figure *f = figure_get(i);
-        if (f->is_dead())
-            continue;
-
-        if (f->is_enemy() || f->is_herd() || f->is_attacking_native()) {
-            int distance = calc_maximum_distance(x, y, x, y);
-            if (distance < min_distance && figure_movement_can_launch_cross_country_missile(x, y, x, y)) {
-                min_distance = distance;
-                min_figure = f;
-            }
-        }
-    }
-    if (min_figure) {
+    // the distance and line of fire are measured from the shooter to itself, so the
+    // first hostile figure by id anywhere on the map becomes the target
+    if (max_distance <= 0)
+        return 0;
+    target_search search;
+    init_search(&search, x, y, SEARCH_WHOLE_MAP);
+    map_figure_foreach_in_radius(x, y, SEARCH_WHOLE_MAP,
+                                 FIGURE_INDEX_MASK(FIGURE_INDEX_ENEMY) | FIGURE_INDEX_MASK(FIGURE_INDEX_ANIMAL) |
+                                 FIGURE_INDEX_MASK(FIGURE_INDEX_CITIZEN),
+                                 first_missile_target_for_soldier, &search);
+    if (search.best_id && figure_movement_can_launch_cross_country_missile(x, y, x, y)) {
+        figure *min_figure = figure_get(search.best_id);
         map_point_store_result(min_figure->tile_x, min_figure->tile_y, tile);
         return min_figure->id;
     }
     return 0;
 }
+
+static void check_missile_target_for_enemy(figure *f, void *user_data) {
+    target_search *search = (target_search *) user_data;
+    if (f->is_dead() || !f->type)
+        return;
+
+    switch (f->type) {
+        case FIGURE_EXPLOSION:
+        case FIGURE_FORT_STANDARD:
+        case FIGURE_MAP_FLAG:
+        case FIGURE_FLOTSAM:
+        case FIGURE_INDIGENOUS_NATIVE:
+        case FIGURE_NATIVE_TRADER:
+        case FIGURE_ARROW:
+        case FIGURE_JAVELIN:
+        case FIGURE_BOLT:
+        case FIGURE_BALLISTA:
+        case FIGURE_CREATURE:
+        case FIGURE_FISH_GULLS:
+        case FIGURE_SHIPWRECK:
+        case FIGURE_SHEEP:
+        case FIGURE_WOLF:
+        case FIGURE_ZEBRA:
+        case FIGURE_SPEAR:
+            return;
+    }
+    int distance;
+    if (f->is_legion())
+        distance = calc_maximum_distance(search->x, search->y, f->tile_x, f->tile_y);
+    else if (search->attack_citizens && f->is_friendly)
+        distance = calc_maximum_distance(search->x, search->y, f->tile_x, f->tile_y) + 5;
+    else {
+        return;
+    }
+    if (distance < search->max_distance && is_better_target(search, distance, f->id) &&
+        figure_movement_can_launch_cross_country_missile(search->x, search->y, f->tile_x, f->tile_y)) {
+        search->best_distance = distance;
+        search->best_id = f->id;
+    }
+}
 int figure_combat_get_missile_target_for_enemy(figure *enemy, int max_distance, int attack_citizens, map_point *tile) {
     int x = enemy->tile_x;
     int y = enemy->tile_y;
 
-    figure *min_figure = 0;
-    int min_distance = max_distance;
-    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
-        figure *f = figure_get(i);
-        if (f->is_dead() || !f->type)
-            continue;
+    int classes = FIGURE_INDEX_MASK(FIGURE_INDEX_SOLDIER);
+    if (attack_citizens)
+        classes |= FIGURE_INDEX_MASK(FIGURE_INDEX_CITIZEN) | FIGURE_INDEX_MASK(FIGURE_INDEX_ENEMY);
 
-        switch (f->type) {
-            case FIGURE_EXPLOSION:
-            case FIGURE_FORT_STANDARD:
-            case FIGURE_MAP_FLAG:
-            case FIGURE_FLOTSAM:
-            case FIGURE_INDIGENOUS_NATIVE:
-            case FIGURE_NATIVE_TRADER:
-            case FIGURE_ARROW:
-            case FIGURE_JAVELIN:
-            case FIGURE_BOLT:
-            case FIGURE_BALLISTA:
-            case FIGURE_CREATURE:
-            case FIGURE_FISH_GULLS:
-            case FIGURE_SHIPWRECK:
-            case FIGURE_SHEEP:
-            case FIGURE_WOLF:
-            case FIGURE_ZEBRA:
-            case FIGURE_SPEAR:
-                continue;
-        }
-        int distance;
-        if (f->is_legion())
-            distance = calc_maximum_distance(x, y, f->tile_x, f->tile_y);
-        else if (attack_citizens && f->is_friendly)
-            distance = calc_maximum_distance(x, y, f->tile_x, f->tile_y) + 5;
-        else {
-            continue;
-        }
-        if (distance < min_distance && figure_movement_can_launch_cross_country_missile(x, y, f->tile_x, f->tile_y)) {
-            min_distance = distance;
-            min_figure = f;
-        }
-    }
-    if (min_figure) {
+    target_search search;
+    init_search(&search, x, y, max_distance);
+    search.attack_citizens = attack_citizens;
+    map_figure_foreach_in_radius(x, y, max_distance, classes, check_missile_target_for_enemy, &search);
+    if (search.best_id) {
+        figure *min_figure = figure_get(search.best_id);
         map_point_store_result(min_figure->tile_x, min_figure->tile_y, tile);
         return min_figure->id;
     }
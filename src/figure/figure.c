@@ -15,7 +15,7 @@
 static struct {
     int created_sequence;
     bool initialized;
-    figure *figures[5000];
+    figure *figures[MAX_FIGURES_CAPACITY];
 } data = {0, false};
 
 figure *figure_get(int id) {
@@ -52,6 +52,7 @@ figure *figure_create(int type, int x, int y, int dir) {
     f->phrase_sequence_city = f->phrase_sequence_exact = random_byte() & 3;
     f->name = figure_name_get(type, 0);
     f->map_figure_add();
+    figure_action_mark_live(id);
     if (type == FIGURE_TRADE_CARAVAN || type == FIGURE_TRADE_SHIP)
         f->trader_id = trader_create();
 
@@ -150,6 +151,7 @@ void init_figures() {
 void figure_init_scenario(void) {
     init_figures();
     data.created_sequence = 0;
+    figure_action_reset_schedule();
 }
 void figure_kill_all() {
     for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++)
@@ -416,4 +418,5 @@ void figure_load_state(buffer *list, buffer *seq) {
         figure_get(i)->load(list);
         figure_get(i)->id = i;
     }
+    figure_action_reset_schedule();
 }
@@ -11,7 +11,9 @@
 #include "window/building/common.h"
 #include "widget/city.h"
 
-static int MAX_FIGURES[] = {5000, 2000};
+// largest entry of MAX_FIGURES, for arrays covering every figure slot of any engine
+#define MAX_FIGURES_CAPACITY 5000
+static int MAX_FIGURES[] = {MAX_FIGURES_CAPACITY, 2000};
 
 class figure {
 public:
@@ -247,6 +247,14 @@ void figure::move_ticks(int num_ticks, int roaming_enabled) {
         if (progress_on_tile < 15)
             advance_tick();
         else {
+            if (routing_path_id <= 0 && !roaming_enabled && (tile_x != destination_x || tile_y != destination_y)
+                && !figure_action_take_route_budget()) {
+                // a path to the destination has to be found, but this tick's routing budget
+                // is used up: stay on the tile and retry next tick. Roamers re-route on every
+                // tile of their walk and are never held back
+                progress_on_tile = 14;
+                break;
+            }
             figure_service_provide_coverage();
             progress_on_tile = 15;
             if (routing_path_id <= 0)
@@ -7,24 +7,19 @@
 #include "game/resource.h"
 #include "map/building.h"
 #include "map/grid.h"
+#include "map/water_supply.h"
 
 #define MAX_COVERAGE 96
 
 static int provide_culture(int x, int y, void (*callback)(building *)) {
     int serviced = 0;
-    int x_min, y_min, x_max, y_max;
-    map_grid_get_area(x, y, 1, 2, &x_min, &y_min, &x_max, &y_max);
-    for (int yy = y_min; yy <= y_max; yy++) {
-        for (int xx = x_min; xx <= x_max; xx++) {
-            int grid_offset = map_grid_offset(xx, yy);
-            int building_id = map_building_at(grid_offset);
-            if (building_id) {
-                building *b = building_get(building_id);
-                if (b->house_size && b->house_population > 0) {
-                    callback(b);
-                    serviced++;
-                }
-            }
+    int count;
+    const uint16_t *buildings = map_building_service_area(x, y, &count);
+    for (int i = 0; i < count; i++) {
+        building *b = building_get(buildings[i]);
+        if (b->house_size && b->house_population > 0) {
+            callback(b);
+            serviced++;
         }
     }
     return serviced;
@@ -32,19 +27,13 @@ static int provide_culture(int x, int y, void (*callback)(building *)) {
 
 static int provide_entertainment(int x, int y, int shows, void (*callback)(building *, int)) {
     int serviced = 0;
-    int x_min, y_min, x_max, y_max;
-    map_grid_get_area(x, y, 1, 2, &x_min, &y_min, &x_max, &y_max);
-    for (int yy = y_min; yy <= y_max; yy++) {
-        for (int xx = x_min; xx <= x_max; xx++) {
-            int grid_offset = map_grid_offset(xx, yy);
-            int building_id = map_building_at(grid_offset);
-            if (building_id) {
-                building *b = building_get(building_id);
-                if (b->house_size && b->house_population > 0) {
-                    callback(b, shows);
-                    serviced++;
-                }
-            }
+    int count;
+    const uint16_t *buildings = map_building_service_area(x, y, &count);
+    for (int i = 0; i < count; i++) {
+        building *b = building_get(buildings[i]);
+        if (b->house_size && b->house_population > 0) {
+            callback(b, shows);
+            serviced++;
         }
     }
     return serviced;
@@ -77,6 +66,9 @@ static void hippodrome_coverage(building *b) {
 }
 
 static void bathhouse_coverage(building *b) {
+    // a bathhouse gives a house water access
+    if (!b->data.house.bathhouse)
+        map_water_supply_building_changed(b->id);
     b->data.house.bathhouse = MAX_COVERAGE;
 }
 static void religion_coverage_ceres(building *b) {
@@ -132,20 +124,13 @@ static int provide_missionary_coverage(int x, int y) {
 
 static int provide_service(int x, int y, int *data, void (*callback)(building *, int *)) {
     int serviced = 0;
-    int x_min, y_min, x_max, y_max;
-    map_grid_get_area(x, y, 1, 2, &x_min, &y_min, &x_max, &y_max);
-    for (int yy = y_min; yy <= y_max; yy++) {
-        for (int xx = x_min; xx <= x_max; xx++) {
-            int grid_offset = map_grid_offset(xx, yy);
-            int building_id = map_building_at(grid_offset);
-            if (building_id) {
-                building *b = building_get(building_id);
-                callback(b, data);
-                if (b->house_size && b->house_population > 0)
-                    serviced++;
-
-            }
-        }
+    int count;
+    const uint16_t *buildings = map_building_service_area(x, y, &count);
+    for (int i = 0; i < count; i++) {
+        building *b = building_get(buildings[i]);
+        callback(b, data);
+        if (b->house_size && b->house_population > 0)
+            serviced++;
     }
     return serviced;
 }
@@ -249,19 +234,13 @@ static void distribute_market_resources(building *b, building *market) {
 static int provide_market_goods(int market_building_id, int x, int y) {
     int serviced = 0;
     building *market = building_get(market_building_id);
-    int x_min, y_min, x_max, y_max;
-    map_grid_get_area(x, y, 1, 2, &x_min, &y_min, &x_max, &y_max);
-    for (int yy = y_min; yy <= y_max; yy++) {
-        for (int xx = x_min; xx <= x_max; xx++) {
-            int grid_offset = map_grid_offset(xx, yy);
-            int building_id = map_building_at(grid_offset);
-            if (building_id) {
-                building *b = building_get(building_id);
-                if (b->house_size && b->house_population > 0) {
-                    distribute_market_resources(b, market);
-                    serviced++;
-                }
-            }
+    int count;
+    const uint16_t *buildings = map_building_service_area(x, y, &count);
+    for (int i = 0; i < count; i++) {
+        building *b = building_get(buildings[i]);
+        if (b->house_size && b->house_population > 0) {
+            distribute_market_resources(b, market);
+            serviced++;
         }
     }
     return serviced;
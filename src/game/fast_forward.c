@@ -0,0 +1,62 @@
+#include "fast_forward.h"
+
+#include "city/population.h"
+#include "core/config.h"
+#include "core/lang.h"
+#include "core/log.h"
+#include "graphics/window.h"
+
+static struct {
+    int active;
+    int stop_on;
+    int population_target;
+} data;
+
+void game_fast_forward_start(int stop_on, int population_target) {
+    data.active = 1;
+    data.stop_on = stop_on;
+    data.population_target = population_target;
+    log_info("Fast-forward started", 0, stop_on);
+}
+void game_fast_forward_stop(void) {
+    if (!data.active)
+        return;
+    data.active = 0;
+    // the city was only drawn now and then, so redraw everything
+    window_invalidate();
+    log_info("Fast-forward stopped", 0, 0);
+}
+void game_fast_forward_toggle(void) {
+    if (data.active)
+        game_fast_forward_stop();
+    else {
+        int stop_on = 0;
+        if (config_get(CONFIG_UI_FAST_FORWARD_STOP_ON_MESSAGE))
+            stop_on |= FAST_FORWARD_STOP_MESSAGE;
+        if (config_get(CONFIG_UI_FAST_FORWARD_STOP_ON_INVASION))
+            stop_on |= FAST_FORWARD_STOP_INVASION;
+        if (config_get(CONFIG_UI_FAST_FORWARD_STOP_ON_REQUEST))
+            stop_on |= FAST_FORWARD_STOP_REQUEST;
+        if (config_get(CONFIG_UI_FAST_FORWARD_STOP_ON_POPULATION))
+            stop_on |= FAST_FORWARD_STOP_POPULATION;
+        game_fast_forward_start(stop_on, (city_population() / 1000 + 1) * 1000);
+    }
+}
+int game_fast_forward_is_active(void) {
+    return data.active;
+}
+
+void game_fast_forward_on_message(int lang_message_type) {
+    if (!data.active)
+        return;
+    if (data.stop_on & FAST_FORWARD_STOP_MESSAGE)
+        game_fast_forward_stop();
+    else if ((data.stop_on & FAST_FORWARD_STOP_INVASION) && lang_message_type == MESSAGE_TYPE_INVASION)
+        game_fast_forward_stop();
+    else if ((data.stop_on & FAST_FORWARD_STOP_REQUEST) && lang_message_type == MESSAGE_TYPE_IMPERIAL)
+        game_fast_forward_stop();
+}
+void game_fast_forward_check_population(int population) {
+    if (data.active && (data.stop_on & FAST_FORWARD_STOP_POPULATION) && population >= data.population_target)
+        game_fast_forward_stop();
+}
@@ -0,0 +1,52 @@
+#ifndef GAME_FAST_FORWARD_H
+#define GAME_FAST_FORWARD_H
+
+/**
+ * @file
+ * Fast-forward mode: the simulation runs as fast as possible and the city is drawn at a reduced rate.
+ */
+
+enum {
+    FAST_FORWARD_STOP_MESSAGE = 1,
+    FAST_FORWARD_STOP_INVASION = 2,
+    FAST_FORWARD_STOP_REQUEST = 4,
+    FAST_FORWARD_STOP_POPULATION = 8
+};
+
+/**
+ * Starts fast-forwarding
+ * @param stop_on Combination of FAST_FORWARD_STOP_* flags
+ * @param population_target Population that stops fast-forward when FAST_FORWARD_STOP_POPULATION is set
+ */
+void game_fast_forward_start(int stop_on, int population_target);
+
+/**
+ * Stops fast-forwarding
+ */
+void game_fast_forward_stop(void);
+
+/**
+ * Toggles fast-forward, stopping on the events chosen in the fast forward settings.
+ * The population condition stops at the next multiple of 1000 citizens.
+ */
+void game_fast_forward_toggle(void);
+
+/**
+ * Checks whether fast-forward is active
+ * @return 1 if active, 0 otherwise
+ */
+int game_fast_forward_is_active(void);
+
+/**
+ * Notifies fast-forward that a city message was posted
+ * @param lang_message_type Message type from the language file
+ */
+void game_fast_forward_on_message(int lang_message_type);
+
+/**
+ * Stops fast-forward when the population target was reached
+ * @param population Current city population
+ */
+void game_fast_forward_check_population(int population);
+
+#endif // GAME_FAST_FORWARD_H
@@ -15,6 +15,7 @@
 #include "city/view.h"
 #include "core/encoding.h"
 #include "core/file.h"
+#include "core/game_environment.h"
 #include "core/game_images.h"
 #include "core/io.h"
 #include "core/lang.h"
@@ -30,6 +31,7 @@
 #include "figuretype/water.h"
 #include "game/animation.h"
 #include "game/difficulty.h"
+#include "game/fast_forward.h"
 #include "game/file_io.h"
 #include "game/settings.h"
 #include "game/state.h"
@@ -54,6 +56,7 @@
 #include "map/soldier_strength.h"
 #include "map/sprite.h"
 #include "map/terrain.h"
+#include "map/water_supply.h"
 #include "map/tiles.h"
 #include "scenario/criteria.h"
 #include "scenario/demand_change.h"
@@ -123,6 +126,7 @@ static void clear_scenario_data(void) {
     map_elevation_clear();
     map_soldier_strength_clear();
     map_road_network_clear();
+    map_water_supply_clear();
 
     map_image_context_init();
     map_random_init();
@@ -226,23 +230,29 @@ static void check_backward_compatibility(void) {
     }
 }
 
-static void initialize_saved_game(void) {
-    load_empire_data(scenario_is_custom(), scenario_empire_id());
-
-    scenario_map_init();
-
-    city_view_init();
-
+// rebuilds the city state that is derived from the loaded data rather than stored in it
+static void initialize_city_state(void) {
     map_routing_update_all();
     map_floodplain_rebuild();
 
     map_orientation_update_buildings();
     figure_route_clean();
+    map_road_network_clear();
     map_road_network_update();
+    map_water_supply_clear();
     building_maintenance_check_rome_access();
     building_granaries_calculate_stocks();
     building_menu_update(BUILDSET_NORMAL);
     city_message_init_problem_areas();
+}
+static void initialize_saved_game(void) {
+    load_empire_data(scenario_is_custom(), scenario_empire_id());
+
+    scenario_map_init();
+
+    city_view_init();
+
+    initialize_city_state();
 
     sound_city_init();
 
@@ -289,6 +299,7 @@ static int load_campaign_mission(int mission_id) {
 }
 
 static int start_scenario(const uint8_t *scenario_name, const char *scenario_file) {
+    game_fast_forward_stop();
     int mission = scenario_campaign_mission();
     int rank = scenario_campaign_rank();
     map_bookmarks_clear();
@@ -345,6 +356,7 @@ int game_file_load_scenario_data(const char *scenario_file) {
     return 1;
 }
 int game_file_load_saved_game(const char *filename) {
+    game_fast_forward_stop();
     if (!game_file_io_read_saved_game(filename, 0))
         return 0;
 
@@ -355,9 +367,44 @@ int game_file_load_saved_game(const char *filename) {
     sound_music_update(1);
     return 1;
 }
+int game_file_restore_saved_game(const char *filename) {
+    if (!game_file_io_read_saved_game(filename, 0))
+        return 0;
+
+    check_backward_compatibility();
+    load_empire_data(scenario_is_custom(), scenario_empire_id());
+    scenario_map_init();
+    initialize_city_state();
+    city_military_determine_distant_battle_city();
+    map_tiles_determine_gardens();
+    map_tiles_river_refresh_entire();
+    building_storage_reset_building_ids();
+    return 1;
+}
 int game_file_write_saved_game(const char *filename) {
     return game_file_io_write_saved_game(filename);
 }
+static void get_quicksave_filenames(char *base_filename, char *delta_filename) {
+    const char *dir = get_game_engine() == ENGINE_ENV_PHARAOH ? "Save/Banderus/" : "";
+    snprintf(base_filename, FILE_NAME_MAX, "%squicksave.svx", dir);
+    snprintf(delta_filename, FILE_NAME_MAX, "%squicksave.dlt", dir);
+}
+int game_file_write_quicksave(void) {
+    char base_filename[FILE_NAME_MAX];
+    char delta_filename[FILE_NAME_MAX];
+    get_quicksave_filenames(base_filename, delta_filename);
+    return game_file_io_write_quicksave(base_filename, delta_filename);
+}
+int game_file_load_quicksave(void) {
+    char base_filename[FILE_NAME_MAX];
+    char delta_filename[FILE_NAME_MAX];
+    get_quicksave_filenames(base_filename, delta_filename);
+    if (file_exists(delta_filename, NOT_LOCALIZED))
+        return game_file_load_saved_game(delta_filename);
+    if (file_exists(base_filename, NOT_LOCALIZED))
+        return game_file_load_saved_game(base_filename);
+    return 0;
+}
 int game_file_delete_saved_game(const char *filename) {
     return game_file_io_delete_saved_game(filename);
 }
@@ -31,6 +31,15 @@ int game_file_load_scenario_data(const char *scenario_file);
  */
 int game_file_load_saved_game(const char *filename);
 
+/**
+ * Restores the city from a saved game of the city being played, for going back to an
+ * earlier state of it. Unlike loading, the view, pause, undo, overlay, tutorial
+ * messages and music are left as they are.
+ * @param filename File to restore from
+ * @return Boolean true on success, false on failure
+ */
+int game_file_restore_saved_game(const char *filename);
+
 /**
  * Write saved game to disk
  * @param filename File to save to
@@ -38,6 +47,18 @@ int game_file_load_saved_game(const char *filename);
  */
 int game_file_write_saved_game(const char *filename);
 
+/**
+ * Quicksave the game, writing only what changed since the last full quicksave when possible
+ * @return Boolean true on success, false on failure
+ */
+int game_file_write_quicksave(void);
+
+/**
+ * Load the most recent quicksave
+ * @return Boolean true on success, false on failure
+ */
+int game_file_load_quicksave(void);
+
 /**
  * Delete saved game
  * @param filename File to delete
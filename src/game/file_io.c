@@ -6,6 +6,8 @@
 #include "building/storage.h"
 #include "city/culture.h"
 #include "city/data.h"
+#include "city/finance.h"
+#include "city/population.h"
 #include "core/file.h"
 #include "core/log.h"
 #include "core/game_images.h"
@@ -14,6 +16,7 @@
 #include "city/view.h"
 #include "core/dir.h"
 #include "core/random.h"
+#include "core/string.h"
 #include "core/zip.h"
 #include "empire/city.h"
 #include "empire/empire.h"
@@ -43,6 +46,7 @@
 #include "scenario/emperor_change.h"
 #include "scenario/gladiator_revolt.h"
 #include "scenario/invasion.h"
+#include "scenario/property.h"
 #include "scenario/scenario.h"
 #include "sound/city.h"
 
@@ -261,9 +265,11 @@ typedef struct {
     buffer *GRID04_8BIT = new buffer;
 } savegame_state;
 
+#define MAX_SAVEGAME_PIECES 200
+
 static struct {
     int num_pieces;
-    file_piece pieces[200];
+    file_piece pieces[MAX_SAVEGAME_PIECES];
     savegame_state state;
 } savegame_data = {0};
 
@@ -971,6 +977,380 @@ static void savegame_write_to_file(FILE *fp) {
     }
 }
 
+// Native chunked save format:
+//   header:   magic "OZSV", u32 format version, u32 game engine, u32 number of sections
+//   toc:      per section: char tag[32], u32 offset, u32 stored size, u32 raw size, u32 checksum, u32 flags
+//   sections: stored back to back, each one compressed independently (or raw)
+// The first section is a small uncompressed "info" block so that the load dialog can
+// show mission and date without decompressing the rest of the file.
+// A delta save additionally has a "delta_base" section naming its base file and the
+// base's checksum id, and only contains the sections that differ from that base.
+#define SAVE_MAGIC "OZSV"
+#define SAVE_FORMAT_VERSION 1
+#define SAVE_HEADER_SIZE 16
+#define SAVE_TAG_LENGTH 32
+#define SAVE_TOC_ENTRY_SIZE (SAVE_TAG_LENGTH + 20)
+#define SAVE_MAX_SECTIONS 210
+#define SAVE_SECTION_COMPRESSED 1
+#define SAVE_INFO_TAG "info"
+#define SAVE_INFO_NAME_LENGTH 65
+#define SAVE_INFO_SIZE (5 * 4 + SAVE_INFO_NAME_LENGTH)
+#define SAVE_DELTA_BASE_TAG "delta_base"
+#define SAVE_DELTA_BASE_SIZE (4 + FILE_NAME_MAX)
+// a delta larger than this share of its base is folded into the base after quicksaving
+#define QUICKSAVE_COMPACT_PERCENTAGE 25
+
+// a full save has a section per piece plus the info section, a delta also names its base
+static_assert(SAVE_MAX_SECTIONS >= MAX_SAVEGAME_PIECES + 2, "save format cannot hold every savegame piece");
+
+typedef struct {
+    char tag[SAVE_TAG_LENGTH];
+    uint32_t offset;
+    uint32_t stored_size;
+    uint32_t raw_size;
+    uint32_t checksum;
+    uint32_t flags;
+    int used;
+} save_section;
+
+static struct {
+    int engine;
+    int num_sections;
+    save_section sections[SAVE_MAX_SECTIONS];
+} save_toc;
+
+// pieces of the last full quicksave written by this session, so that the next quicksave
+// can find its changes without reading the base file back
+static struct {
+    char filename[FILE_NAME_MAX];
+    uint32_t id;
+    int num_pieces;
+    uint64_t hashes[MAX_SAVEGAME_PIECES];
+} quicksave_base;
+
+static uint32_t section_checksum(const uint8_t *data, size_t size) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+static uint64_t piece_hash(const buffer *buf) {
+    // 64-bit FNV-1a: pieces are compared by hash alone, so it has to be wider than the checksum
+    const uint8_t *data = buf->get_data();
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < buf->size(); i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+static int is_skipped_piece(const file_piece *piece) {
+    // unknown Pharaoh data that is never loaded: not worth storing
+    return strncmp(piece->name, "junk", 4) == 0;
+}
+static int is_native_save(FILE *fp) {
+    char magic[4];
+    long start = ftell(fp);
+    int result = fread(magic, 1, 4, fp) == 4 && memcmp(magic, SAVE_MAGIC, 4) == 0;
+    fseek(fp, start, SEEK_SET);
+    return result;
+}
+
+static void write_save_toc(FILE *fp) {
+    buffer buf(SAVE_HEADER_SIZE + save_toc.num_sections * SAVE_TOC_ENTRY_SIZE);
+    buf.write_raw(SAVE_MAGIC, 4);
+    buf.write_u32(SAVE_FORMAT_VERSION);
+    buf.write_u32(save_toc.engine);
+    buf.write_u32(save_toc.num_sections);
+    for (int i = 0; i < save_toc.num_sections; i++) {
+        save_section *section = &save_toc.sections[i];
+        buf.write_raw(section->tag, SAVE_TAG_LENGTH);
+        buf.write_u32(section->offset);
+        buf.write_u32(section->stored_size);
+        buf.write_u32(section->raw_size);
+        buf.write_u32(section->checksum);
+        buf.write_u32(section->flags);
+    }
+    buf.to_file(buf.size(), fp);
+}
+static int read_save_toc(FILE *fp) {
+    buffer header(SAVE_HEADER_SIZE);
+    if (header.from_file(SAVE_HEADER_SIZE, fp) != SAVE_HEADER_SIZE)
+        return 0;
+    char magic[4];
+    header.read_raw(magic, 4);
+    int version = header.read_u32();
+    save_toc.engine = header.read_u32();
+    save_toc.num_sections = header.read_u32();
+    if (memcmp(magic, SAVE_MAGIC, 4) != 0 || version > SAVE_FORMAT_VERSION
+        || save_toc.num_sections < 0 || save_toc.num_sections > SAVE_MAX_SECTIONS) {
+        log_error("Unsupported save format version", 0, version);
+        return 0;
+    }
+    size_t toc_size = save_toc.num_sections * SAVE_TOC_ENTRY_SIZE;
+    buffer toc(toc_size);
+    if (toc.from_file(toc_size, fp) != toc_size)
+        return 0;
+    for (int i = 0; i < save_toc.num_sections; i++) {
+        save_section *section = &save_toc.sections[i];
+        toc.read_raw(section->tag, SAVE_TAG_LENGTH);
+        section->tag[SAVE_TAG_LENGTH - 1] = 0;
+        section->offset = toc.read_u32();
+        section->stored_size = toc.read_u32();
+        section->raw_size = toc.read_u32();
+        section->checksum = toc.read_u32();
+        section->flags = toc.read_u32();
+        section->used = 0;
+    }
+    return 1;
+}
+static save_section *find_save_section(const char *tag) {
+    // tags are not unique ("empire"), so hand out matching sections in file order
+    for (int i = 0; i < save_toc.num_sections; i++) {
+        save_section *section = &save_toc.sections[i];
+        if (!section->used && strncmp(section->tag, tag, SAVE_TAG_LENGTH) == 0) {
+            section->used = 1;
+            return section;
+        }
+    }
+    return 0;
+}
+static int read_save_section(FILE *fp, const save_section *section, buffer *buf) {
+    // every section has the fixed size of the piece it is read into: anything else is a
+    // damaged file, rejected before reading so that the sizes in it are never trusted
+    if (section->raw_size != buf->size()) {
+        log_error("Save section has an unexpected size", section->tag, (int) section->raw_size);
+        return 0;
+    }
+    int compressed = section->flags & SAVE_SECTION_COMPRESSED;
+    if ((compressed && section->stored_size > COMPRESS_BUFFER_SIZE)
+        || (!compressed && section->stored_size != section->raw_size)) {
+        log_error("Save section has an unexpected size", section->tag, (int) section->stored_size);
+        return 0;
+    }
+    if (fseek(fp, section->offset, SEEK_SET))
+        return 0;
+    buf->clear();
+    if (compressed) {
+        int output_size = section->raw_size;
+        if (fread(compress_buffer, 1, section->stored_size, fp) != section->stored_size
+            || !zip_decompress(compress_buffer, section->stored_size, buf->data_unsafe_pls_use_carefully(),
+                               &output_size)
+            || output_size != (int) section->raw_size)
+            return 0;
+    } else if (buf->from_file(section->raw_size, fp) != section->raw_size) {
+        return 0;
+    }
+    if (section_checksum(buf->get_data(), buf->size()) != section->checksum) {
+        log_error("Save section checksum mismatch", section->tag, 0);
+        return 0;
+    }
+    return 1;
+}
+static void write_save_section(FILE *fp, const char *tag, buffer *buf, int compressed) {
+    save_section *section = &save_toc.sections[save_toc.num_sections++];
+    memset(section, 0, sizeof(save_section));
+    strncpy(section->tag, tag, SAVE_TAG_LENGTH - 1);
+    section->offset = ftell(fp);
+    section->raw_size = buf->size();
+    section->checksum = section_checksum(buf->get_data(), buf->size());
+
+    int output_size = COMPRESS_BUFFER_SIZE;
+    if (compressed && buf->size() <= COMPRESS_BUFFER_SIZE
+        && zip_compress(buf->get_data(), buf->size(), compress_buffer, &output_size)
+        && output_size < (int) buf->size()) {
+        section->flags = SAVE_SECTION_COMPRESSED;
+        section->stored_size = output_size;
+        fwrite(compress_buffer, 1, output_size, fp);
+    } else {
+        section->stored_size = buf->size();
+        buf->to_file(buf->size(), fp);
+    }
+}
+static void write_save_info(buffer *buf, const saved_game_info *info) {
+    if (info) {
+        buf->write_i32(info->mission);
+        buf->write_i32(info->year);
+        buf->write_i32(info->month);
+        buf->write_i32(info->population);
+        buf->write_i32(info->treasury);
+        buf->write_raw(info->scenario_name, SAVE_INFO_NAME_LENGTH);
+        return;
+    }
+    uint8_t name[SAVE_INFO_NAME_LENGTH] = {0};
+    string_copy(scenario_name(), name, SAVE_INFO_NAME_LENGTH);
+    buf->write_i32(scenario_campaign_mission());
+    buf->write_i32(game_time_year());
+    buf->write_i32(game_time_month());
+    buf->write_i32(city_population());
+    buf->write_i32(city_finance_treasury());
+    buf->write_raw(name, SAVE_INFO_NAME_LENGTH);
+}
+static void read_save_info(buffer *buf, saved_game_info *info) {
+    info->mission = buf->read_i32();
+    info->year = buf->read_i32();
+    info->month = buf->read_i32();
+    info->population = buf->read_i32();
+    info->treasury = buf->read_i32();
+    buf->read_raw(info->scenario_name, SAVE_INFO_NAME_LENGTH);
+    info->scenario_name[SAVE_INFO_NAME_LENGTH - 1] = 0;
+}
+
+static uint32_t save_toc_id(void) {
+    // identifies a file by the checksums of all its sections
+    uint32_t checksums[SAVE_MAX_SECTIONS];
+    for (int i = 0; i < save_toc.num_sections; i++)
+        checksums[i] = save_toc.sections[i].checksum;
+    return section_checksum((const uint8_t *) checksums, save_toc.num_sections * sizeof(uint32_t));
+}
+static int read_save_pieces(FILE *fp, long start, int clear_missing) {
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        file_piece *piece = &savegame_data.pieces[i];
+        save_section *section = find_save_section(piece->name);
+        if (!section) {
+            // section added in a later version, left out, or unchanged in a delta
+            if (clear_missing)
+                piece->buf->clear();
+            continue;
+        }
+        save_section relative = *section;
+        relative.offset += start;
+        if (!read_save_section(fp, &relative, piece->buf)) {
+            log_error("Unable to read save section", piece->name, 0);
+            return 0;
+        }
+    }
+    return 1;
+}
+static int savegame_read_native_from_file(FILE *fp, int allow_delta) {
+    long start = ftell(fp);
+    if (!read_save_toc(fp))
+        return 0;
+    if (save_toc.engine != get_game_engine()) {
+        log_error("Save was written for another game", 0, save_toc.engine);
+        return 0;
+    }
+    save_section *base_section = find_save_section(SAVE_DELTA_BASE_TAG);
+    if (!base_section)
+        return read_save_pieces(fp, start, 1);
+
+    // delta save: load the base file first, then apply the changed sections on top
+    buffer base_ref(SAVE_DELTA_BASE_SIZE);
+    save_section relative = *base_section;
+    relative.offset += start;
+    if (!allow_delta || !read_save_section(fp, &relative, &base_ref))
+        return 0;
+    uint32_t base_id = base_ref.read_u32();
+    char base_filename[FILE_NAME_MAX] = {0};
+    base_ref.read_raw(base_filename, FILE_NAME_MAX - 1);
+
+    static struct {
+        int engine;
+        int num_sections;
+        save_section sections[SAVE_MAX_SECTIONS];
+    } delta_toc;
+    memcpy(&delta_toc, &save_toc, sizeof(save_toc));
+
+    FILE *base_fp = file_exists(base_filename, NOT_LOCALIZED)
+                    ? file_open(dir_get_file(base_filename, NOT_LOCALIZED), "rb") : 0;
+    if (!base_fp) {
+        log_error("Unable to open base of delta save", base_filename, 0);
+        return 0;
+    }
+    int result = is_native_save(base_fp) && savegame_read_native_from_file(base_fp, 0);
+    if (result && save_toc_id() != base_id) {
+        log_error("Base of delta save has changed", base_filename, 0);
+        result = 0;
+    }
+    file_close(base_fp);
+
+    memcpy(&save_toc, &delta_toc, sizeof(save_toc));
+    return result && read_save_pieces(fp, start, 0);
+}
+static int savegame_write_native_to_file(FILE *fp, const saved_game_info *info, const int *changed_pieces,
+                                         uint32_t base_id, const char *base_filename) {
+    save_toc.engine = get_game_engine();
+    save_toc.num_sections = 0;
+    int num_sections = changed_pieces ? 2 : 1;
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        if (!is_skipped_piece(&savegame_data.pieces[i]) && (!changed_pieces || changed_pieces[i]))
+            num_sections++;
+    }
+    if (num_sections > SAVE_MAX_SECTIONS)
+        return 0;
+
+    // reserve room for the table of contents, fill it in once all offsets are known
+    save_toc.num_sections = num_sections;
+    write_save_toc(fp);
+    save_toc.num_sections = 0;
+
+    buffer info_buf(SAVE_INFO_SIZE);
+    write_save_info(&info_buf, info);
+    write_save_section(fp, SAVE_INFO_TAG, &info_buf, 0);
+    if (changed_pieces) {
+        buffer base_ref(SAVE_DELTA_BASE_SIZE);
+        base_ref.write_u32(base_id);
+        base_ref.write_raw(base_filename, strlen(base_filename) < FILE_NAME_MAX ? strlen(base_filename) : FILE_NAME_MAX);
+        write_save_section(fp, SAVE_DELTA_BASE_TAG, &base_ref, 0);
+    }
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        file_piece *piece = &savegame_data.pieces[i];
+        if (!is_skipped_piece(piece) && (!changed_pieces || changed_pieces[i]))
+            write_save_section(fp, piece->name, piece->buf, piece->compressed);
+    }
+    fseek(fp, 0, SEEK_SET);
+    write_save_toc(fp);
+    return 1;
+}
+static void remember_quicksave_base(const char *base_filename) {
+    // called right after writing a full base: save_toc still describes that file
+    strncpy(quicksave_base.filename, base_filename, FILE_NAME_MAX - 1);
+    quicksave_base.id = save_toc_id();
+    quicksave_base.num_pieces = savegame_data.num_pieces;
+    for (int i = 0; i < savegame_data.num_pieces; i++)
+        quicksave_base.hashes[i] = piece_hash(savegame_data.pieces[i].buf);
+}
+static int find_changed_pieces(const char *base_filename, int *changed_pieces, uint32_t *base_id,
+                               size_t *base_size) {
+    // compare the freshly serialized pieces against the hashes of the base this session wrote;
+    // a base from an earlier session is not read back, the quicksave is written in full instead
+    if (quicksave_base.num_pieces != savegame_data.num_pieces
+        || strcmp(quicksave_base.filename, base_filename) != 0
+        || !file_exists(base_filename, NOT_LOCALIZED))
+        return 0;
+    FILE *fp = file_open(dir_get_file(base_filename, NOT_LOCALIZED), "rb");
+    if (!fp)
+        return 0;
+    int is_known_base = is_native_save(fp) && read_save_toc(fp) && save_toc.engine == get_game_engine()
+                        && !find_save_section(SAVE_DELTA_BASE_TAG) && save_toc_id() == quicksave_base.id;
+    file_close(fp);
+    if (!is_known_base)
+        return 0;
+
+    *base_id = quicksave_base.id;
+    *base_size = 0;
+    for (int i = 0; i < save_toc.num_sections; i++)
+        *base_size += save_toc.sections[i].stored_size;
+    size_t changed_bytes = 0;
+    size_t total_bytes = 0;
+    for (int i = 0; i < savegame_data.num_pieces; i++) {
+        file_piece *piece = &savegame_data.pieces[i];
+        changed_pieces[i] = 0;
+        if (is_skipped_piece(piece))
+            continue;
+        total_bytes += piece->buf->size();
+        if (piece_hash(piece->buf) != quicksave_base.hashes[i]) {
+            changed_pieces[i] = 1;
+            changed_bytes += piece->buf->size();
+        }
+    }
+    // once the delta grows past half of the game, a full save is just as cheap
+    return changed_bytes * 2 < total_bytes;
+}
+
 int game_file_io_read_scenario(const char *filename) {
     return 0;
 //    log_info("Loading scenario", filename, 0);
@@ -1009,16 +1389,6 @@ int game_file_io_write_scenario(const char *filename) {
 //    return 1;
 }
 int game_file_io_read_saved_game(const char *filename, int offset) {
-    if (file_has_extension(filename, "pak")) {
-        log_info("Loading saved game.", filename, 0);
-        init_savegame_data(0);
-        game_images::get().set_terrain_ph_offset(539); //14791
-    } else {
-        log_info("Loading saved game (expanded).", filename, 0);
-        init_savegame_data(1);
-        game_images::get().set_terrain_ph_offset(0); //14252
-    }
-
     log_info("Loading saved game", filename, 0);
     FILE *fp = file_open(dir_get_file(filename, NOT_LOCALIZED), "rb");
     if (!fp) {
@@ -1028,8 +1398,24 @@ int game_file_io_read_saved_game(const char *filename, int offset) {
     if (offset)
         fseek(fp, offset, SEEK_SET);
 
-
-    int result = savegame_read_from_file(fp);
+    int result;
+    if (is_native_save(fp)) {
+        log_info("Loading saved game (native).", filename, 0);
+        init_savegame_data(1);
+        game_images::get().set_terrain_ph_offset(0);
+        result = savegame_read_native_from_file(fp, 1);
+    } else {
+        if (file_has_extension(filename, "pak")) {
+            log_info("Loading saved game.", filename, 0);
+            init_savegame_data(0);
+            game_images::get().set_terrain_ph_offset(539); //14791
+        } else {
+            log_info("Loading saved game (expanded).", filename, 0);
+            init_savegame_data(1);
+            game_images::get().set_terrain_ph_offset(0); //14252
+        }
+        result = savegame_read_from_file(fp);
+    }
     file_close(fp);
     if (!result) {
         log_error("Unable to load game, unable to read savefile.", 0, 0);
@@ -1038,6 +1424,52 @@ int game_file_io_read_saved_game(const char *filename, int offset) {
     savegame_load_from_state(&savegame_data.state);
     return 1;
 }
+int game_file_io_read_saved_game_info(const char *filename, saved_game_info *info) {
+    FILE *fp = file_open(dir_get_file(filename, NOT_LOCALIZED), "rb");
+    if (!fp)
+        return 0;
+    int result = 0;
+    if (is_native_save(fp) && read_save_toc(fp)) {
+        save_section *section = find_save_section(SAVE_INFO_TAG);
+        buffer buf(SAVE_INFO_SIZE);
+        if (section && read_save_section(fp, section, &buf)) {
+            read_save_info(&buf, info);
+            result = 1;
+        }
+    }
+    file_close(fp);
+    return result;
+}
+int game_file_io_read_legacy_saved_game_info(const char *filename, saved_game_info *info) {
+    FILE *fp = file_open(dir_get_file(filename, NOT_LOCALIZED), "rb");
+    if (!fp)
+        return 0;
+    int result = 0;
+    if (!is_native_save(fp)) {
+        // the summary is spread over the game: read the whole file, but keep it out of the game
+        init_savegame_data(file_has_extension(filename, "pak") ? 0 : 1);
+        result = savegame_read_from_file(fp);
+    }
+    file_close(fp);
+    if (!result)
+        return 0;
+
+    savegame_state *state = &savegame_data.state;
+    if (get_game_engine() == ENGINE_ENV_PHARAOH)
+        info->mission = state->scenario_campaign_mission->read_i8();
+    else
+        info->mission = state->scenario_campaign_mission->read_i32();
+    state->game_time->skip(8);
+    info->month = state->game_time->read_i32();
+    info->year = state->game_time->read_i32();
+    city_data_read_summary(state->city_data, &info->treasury, &info->population);
+    memset(info->scenario_name, 0, sizeof(info->scenario_name));
+    int name_length = env_sizes().MAX_SCENARIO_NAME;
+    if (name_length > SAVE_INFO_NAME_LENGTH - 1)
+        name_length = SAVE_INFO_NAME_LENGTH - 1;
+    state->scenario_name->read_raw(info->scenario_name, name_length);
+    return 1;
+}
 int game_file_io_write_saved_game(const char *filename) {
     init_savegame_data(1);
 
@@ -1050,9 +1482,74 @@ int game_file_io_write_saved_game(const char *filename) {
         log_error("Unable to save game", 0, 0);
         return 0;
     }
-    savegame_write_to_file(fp);
+    int result = savegame_write_native_to_file(fp, 0, 0, 0, 0);
     file_close(fp);
-    return 1;
+    if (!result)
+        log_error("Unable to save game", 0, 0);
+    return result;
+}
+int game_file_io_write_quicksave(const char *base_filename, const char *delta_filename) {
+    init_savegame_data(1);
+    savegame_save_to_state(&savegame_data.state);
+
+    static int changed_pieces[MAX_SAVEGAME_PIECES];
+    uint32_t base_id = 0;
+    size_t base_size = 0;
+    int write_delta = find_changed_pieces(base_filename, changed_pieces, &base_id, &base_size);
+    const char *filename = write_delta ? delta_filename : base_filename;
+    log_info(write_delta ? "Quicksaving changes" : "Quicksaving full game", filename, 0);
+
+    FILE *fp = file_open(filename, "wb");
+    if (!fp) {
+        log_error("Unable to save game", 0, 0);
+        return 0;
+    }
+    int result = write_delta
+        ? savegame_write_native_to_file(fp, 0, changed_pieces, base_id, base_filename)
+        : savegame_write_native_to_file(fp, 0, 0, 0, 0);
+    fseek(fp, 0, SEEK_END);
+    size_t written_size = ftell(fp);
+    file_close(fp);
+    if (result && !write_delta) {
+        remember_quicksave_base(base_filename);
+        if (file_exists(delta_filename, NOT_LOCALIZED))
+            file_remove(delta_filename);
+    }
+    if (result && write_delta && written_size * 100 > base_size * QUICKSAVE_COMPACT_PERCENTAGE) {
+        // loading reads both files: fold a large delta into the base to keep that cheap
+        log_info("Compacting quicksave", delta_filename, (int) written_size);
+        if (!game_file_io_compact_quicksave(base_filename, delta_filename))
+            log_error("Unable to compact quicksave, keeping the delta", delta_filename, 0);
+    }
+    return result;
+}
+int game_file_io_compact_quicksave(const char *base_filename, const char *delta_filename) {
+    if (!file_exists(delta_filename, NOT_LOCALIZED))
+        return 1;
+    saved_game_info info;
+    if (!game_file_io_read_saved_game_info(delta_filename, &info))
+        return 0;
+    FILE *fp = file_open(dir_get_file(delta_filename, NOT_LOCALIZED), "rb");
+    if (!fp)
+        return 0;
+    init_savegame_data(1);
+    int result = is_native_save(fp) && savegame_read_native_from_file(fp, 1);
+    file_close(fp);
+    if (!result) {
+        log_error("Unable to compact quicksave", delta_filename, 0);
+        return 0;
+    }
+    // keep the summary of the delta: it describes the most recent state
+    fp = file_open(base_filename, "wb");
+    if (!fp)
+        return 0;
+    result = savegame_write_native_to_file(fp, &info, 0, 0, 0);
+    file_close(fp);
+    if (result) {
+        remember_quicksave_base(base_filename);
+        file_remove(delta_filename);
+    }
+    return result;
 }
 int game_file_io_delete_saved_game(const char *filename) {
     log_info("Deleting game", filename, 0);
@@ -1,14 +1,64 @@
 #ifndef GAME_FILE_IO_H
 #define GAME_FILE_IO_H
 
+#include <stdint.h>
+
+/**
+ * Summary of a saved game, stored in the header section of native saves
+ */
+typedef struct {
+    int mission;
+    int year;
+    int month;
+    int population;
+    int treasury;
+    uint8_t scenario_name[65];
+} saved_game_info;
+
 int game_file_io_read_scenario(const char *filename);
 
 int game_file_io_write_scenario(const char *filename);
 
 int game_file_io_read_saved_game(const char *filename, int offset);
 
+/**
+ * Reads only the summary section of a saved game, without loading the game
+ * @param filename File to read
+ * @param info Summary to fill
+ * @return Boolean true on success, false if the file could not be read or is not a native save
+ */
+int game_file_io_read_saved_game_info(const char *filename, saved_game_info *info);
+
+/**
+ * Reads the summary of a saved game in the original format, which has no summary section.
+ * This reads the whole file, but does not load the game.
+ * @param filename File to read
+ * @param info Summary to fill
+ * @return Boolean true on success, false if the file could not be read or is a native save
+ */
+int game_file_io_read_legacy_saved_game_info(const char *filename, saved_game_info *info);
+
 int game_file_io_write_saved_game(const char *filename);
 
+/**
+ * Quicksaves the game. If the base file is a full quicksave written earlier in this session,
+ * only the pieces that differ from it are written to the delta file; otherwise, or when most
+ * of the game changed, a full save is written to the base file and the delta file is removed.
+ * A delta that ends up larger than a quarter of its base is compacted into the base.
+ * @param base_filename Full save the delta refers to
+ * @param delta_filename Delta file
+ * @return Boolean true on success, false on failure
+ */
+int game_file_io_write_quicksave(const char *base_filename, const char *delta_filename);
+
+/**
+ * Folds the delta file back into its base file and removes the delta
+ * @param base_filename Full save the delta refers to
+ * @param delta_filename Delta file
+ * @return Boolean true on success or if there is no delta, false on failure
+ */
+int game_file_io_compact_quicksave(const char *base_filename, const char *delta_filename);
+
 int game_file_io_delete_saved_game(const char *filename);
 
 #endif // GAME_FILE_IO_H
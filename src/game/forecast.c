@@ -0,0 +1,82 @@
+#include "forecast.h"
+
+#include "city/finance.h"
+#include "city/population.h"
+#include "city/ratings.h"
+#include "city/resource.h"
+#include "core/file.h"
+#include "core/game_environment.h"
+#include "core/log.h"
+#include "game/file.h"
+#include "game/tick.h"
+#include "game/time.h"
+#include "game/undo.h"
+
+#include <stdio.h>
+
+// generous upper bound on the ticks in a month, in case the clock gets stuck
+#define MAX_TICKS_PER_MONTH (50 * 16 * 2)
+
+static struct {
+    int running;
+} data;
+
+static void get_forecast_filename(char *filename) {
+    const char *dir = get_game_engine() == ENGINE_ENV_PHARAOH ? "Save/Banderus/" : "";
+    snprintf(filename, FILE_NAME_MAX, "%sforecast.svx", dir);
+}
+static void record_month(forecast_month *result) {
+    result->treasury = city_finance_treasury();
+    result->population = city_population();
+    result->food_stored = city_resource_food_stored();
+    result->culture = city_rating_culture();
+    result->prosperity = city_rating_prosperity();
+    result->peace = city_rating_peace();
+    result->favor = city_rating_favor();
+}
+static int run_months(int months, forecast_month *results) {
+    int done = 0;
+    while (done < months) {
+        int month = game_time_month();
+        int ticks = 0;
+        while (game_time_month() == month && ticks < MAX_TICKS_PER_MONTH) {
+            game_tick_run();
+            ticks++;
+        }
+        if (game_time_month() == month)
+            break;
+        record_month(&results[done++]);
+    }
+    return done;
+}
+
+int game_forecast_run(int months, forecast_month *results) {
+    if (data.running || months <= 0)
+        return 0;
+    if (months > FORECAST_MAX_MONTHS)
+        months = FORECAST_MAX_MONTHS;
+
+    // the city lives in module state all over the tree, so a save is the one complete copy of it
+    char filename[FILE_NAME_MAX];
+    get_forecast_filename(filename);
+    if (!game_file_write_saved_game(filename)) {
+        log_error("Unable to save the city for the forecast", filename, 0);
+        return 0;
+    }
+    data.running = 1;
+    game_undo_hold(1);
+    int done = run_months(months, results);
+    game_undo_hold(0);
+    data.running = 0;
+
+    if (!game_file_restore_saved_game(filename)) {
+        // the city is now in the future: keep the save so the player can get back from it
+        log_error("Unable to restore the city after the forecast, it is kept in", filename, 0);
+        return FORECAST_RESTORE_FAILED;
+    }
+    game_file_delete_saved_game(filename);
+    return done;
+}
+int game_forecast_is_running(void) {
+    return data.running;
+}
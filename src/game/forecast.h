@@ -0,0 +1,42 @@
+#ifndef GAME_FORECAST_H
+#define GAME_FORECAST_H
+
+#define FORECAST_MAX_MONTHS 24
+#define FORECAST_RESTORE_FAILED -1
+
+/**
+ * @file
+ * What-if forecasting: runs the city ahead and restores it afterwards.
+ */
+
+typedef struct {
+    int treasury;
+    int population;
+    int food_stored;
+    int culture;
+    int prosperity;
+    int peace;
+    int favor;
+} forecast_month;
+
+/**
+ * Runs the simulation a number of months ahead, recording the city at the end of each month,
+ * and then restores the game to where it was. Sounds, popups, autosaves and mission end
+ * dialogs are suppressed while the forecast runs, and the view, pause state and undo
+ * are left untouched.
+ * @param months Number of months to forecast, at most FORECAST_MAX_MONTHS
+ * @param results Array of at least months entries to fill
+ * @return Number of months forecast, 0 if the game could not be saved, or
+ *         FORECAST_RESTORE_FAILED if the city could not be restored afterwards. It is then
+ *         left in the future, with its earlier state kept in forecast.svx
+ */
+int game_forecast_run(int months, forecast_month *results);
+
+/**
+ * Checks whether a forecast is running, so that systems with effects outside the
+ * simulation can hold back
+ * @return 1 if a forecast is running, 0 otherwise
+ */
+int game_forecast_is_running(void);
+
+#endif // GAME_FORECAST_H
@@ -2,6 +2,7 @@
 
 #include "building/construction.h"
 #include "building/model.h"
+#include "city/population.h"
 #include "core/config.h"
 #include "core/hotkey_config.h"
 #include "core/game_images.h"
@@ -15,8 +16,10 @@
 #include "figure/type.h"
 #include "game/animation.h"
 #include "game/file.h"
+#include "game/fast_forward.h"
 #include "game/file_editor.h"
 #include "game/settings.h"
+#include "game/startup.h"
 #include "game/state.h"
 #include "game/tick.h"
 #include "graphics/font.h"
@@ -24,11 +27,13 @@
 #include "graphics/window.h"
 #include "input/cursor.h"
 #include "input/scroll.h"
+#include "platform/platform.h"
 #include "scenario/property.h"
 #include "scenario/scenario.h"
 #include "sound/city.h"
 #include "sound/system.h"
 #include "translation/translation.h"
+#include "widget/minimap.h"
 #include "window/editor/map.h"
 #include "window/logo.h"
 #include "window/main_menu.h"
@@ -37,6 +42,9 @@ static const time_millis MILLIS_PER_TICK_PER_SPEED[] = {
         0, 20, 35, 55, 80, 110, 160, 240, 350, 500, 700
 };
 
+// fast-forward runs ticks for this long per frame, so the city is drawn about 5 times per second
+#define FAST_FORWARD_FRAME_MILLIS 200
+
 static time_millis last_update;
 
 static void errlog(const char *msg) {
@@ -114,6 +122,8 @@ static int get_elapsed_ticks(void) {
     if (scroll_in_progress() && !scroll_is_smooth())
         return 0;
 
+    if (game_fast_forward_is_active())
+        return 1;
 
     time_millis now = time_get_millis();
     time_millis diff = now - last_update;
@@ -138,6 +148,7 @@ int game_pre_init(void) {
     return 1;
 }
 int game_init(void) {
+    game_startup_stage("images");
     if (!game_images::get().load_main(CLIMATE_CENTRAL, 0, 0)) {
         errlog("unable to load main graphics");
         return 0;
@@ -156,15 +167,19 @@ int game_init(void) {
         }
     }
 
+    game_startup_stage("model");
     if (!model_load()) {
         errlog("unable to load model.txt");
         return 0;
     }
 
 //    mods_init();
+    game_startup_stage("sound");
     sound_system_init();
+    game_startup_stage("game state");
     game_state_init();
     window_logo_show(missing_fonts ? MESSAGE_MISSING_FONTS : (is_unpatched() ? MESSAGE_MISSING_PATCH : MESSAGE_NONE));
+    game_startup_done();
 
     return 1;
 }
@@ -193,9 +208,29 @@ void game_exit_editor(void) {
 int game_reload_language(void) {
     return reload_language(0, 1);
 }
+static void run_fast_forward(void) {
+    unsigned int start = platform_get_millis();
+    int window_id = window_get_id();
+    while (game_fast_forward_is_active() && platform_get_millis() - start < FAST_FORWARD_FRAME_MILLIS) {
+        game_tick_run();
+        game_file_write_mission_saved_game();
+        game_fast_forward_check_population(city_population());
+
+        // a popup or other window took over
+        if (window_get_id() != window_id)
+            break;
+    }
+    // ticks skip the minimap updates while fast-forwarding, refresh it once per frame instead
+    widget_minimap_invalidate();
+}
+
 void game_run(void) {
     game_animation_update();
     int num_ticks = get_elapsed_ticks();
+    if (num_ticks && game_fast_forward_is_active()) {
+        run_fast_forward();
+        return;
+    }
     for (int i = 0; i < num_ticks; i++) {
         game_tick_run();
         game_file_write_mission_saved_game();
@@ -206,7 +241,8 @@ void game_run(void) {
 }
 void game_draw(void) {
     window_draw(0);
-    sound_city_play();
+    if (!game_fast_forward_is_active())
+        sound_city_play();
 }
 void game_exit(void) {
     video_shutdown();
@@ -0,0 +1,200 @@
+#include "save_index.h"
+
+#include "core/buffer.h"
+#include "core/file.h"
+#include "core/log.h"
+#include "platform/file_manager.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define INDEX_FILENAME "savegames.idx"
+#define INDEX_MAGIC "OZSI"
+#define INDEX_VERSION 1
+#define INDEX_HEADER_SIZE 12
+#define INDEX_ENTRY_SIZE (FILE_NAME_MAX + 4 + 8 + 1 + 5 * 4 + sizeof(((saved_game_info *) 0)->scenario_name))
+
+enum {
+    INFO_NOT_READ = 0,
+    INFO_AVAILABLE = 1,
+    INFO_MISSING = 2
+};
+
+typedef struct {
+    char filename[FILE_NAME_MAX];
+    long size;
+    long long mtime;
+    int has_info;
+    saved_game_info info;
+} index_entry;
+
+static struct {
+    char dir[FILE_NAME_MAX];
+    index_entry *entries;
+    int num_entries;
+    int max_entries;
+    int is_dirty;
+} data;
+
+static void get_path(const char *filename, char *path) {
+    if (strcmp(data.dir, ".") == 0)
+        snprintf(path, FILE_NAME_MAX, "%s", filename);
+    else
+        snprintf(path, FILE_NAME_MAX, "%s%s", data.dir, filename);
+}
+
+static index_entry *find_entry(index_entry *entries, int num_entries, const char *filename) {
+    for (int i = 0; i < num_entries; i++) {
+        if (strcmp(entries[i].filename, filename) == 0)
+            return &entries[i];
+    }
+    return 0;
+}
+
+static void ensure_capacity(int count) {
+    if (count <= data.max_entries)
+        return;
+    data.max_entries = count > 2 * data.max_entries ? count : 2 * data.max_entries;
+    data.entries = (index_entry *) realloc(data.entries, data.max_entries * sizeof(index_entry));
+}
+
+static void load_index(void) {
+    data.num_entries = 0;
+    char path[FILE_NAME_MAX];
+    get_path(INDEX_FILENAME, path);
+    long file_size = 0;
+    long long mtime = 0;
+    if (!platform_file_manager_get_file_info(path, &file_size, &mtime))
+        return;
+    FILE *fp = file_open(path, "rb");
+    if (!fp)
+        return;
+
+    // a damaged count must not make us allocate more than the file can hold
+    int max_count = file_size > INDEX_HEADER_SIZE ? (int) ((file_size - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE) : 0;
+    buffer header(INDEX_HEADER_SIZE);
+    if (header.from_file(INDEX_HEADER_SIZE, fp) == INDEX_HEADER_SIZE) {
+        char magic[4];
+        header.read_raw(magic, 4);
+        int version = header.read_i32();
+        int count = header.read_i32();
+        if (memcmp(magic, INDEX_MAGIC, 4) == 0 && version == INDEX_VERSION && count > 0 && count <= max_count) {
+            buffer buf(count * INDEX_ENTRY_SIZE);
+            if (buf.from_file(buf.size(), fp) == buf.size()) {
+                ensure_capacity(count);
+                for (int i = 0; i < count; i++) {
+                    index_entry *entry = &data.entries[i];
+                    buf.read_raw(entry->filename, FILE_NAME_MAX);
+                    entry->filename[FILE_NAME_MAX - 1] = 0;
+                    entry->size = buf.read_i32();
+                    uint32_t mtime_low = buf.read_u32();
+                    uint32_t mtime_high = buf.read_u32();
+                    entry->mtime = (long long) (((uint64_t) mtime_high << 32) | mtime_low);
+                    entry->has_info = buf.read_u8();
+                    entry->info.mission = buf.read_i32();
+                    entry->info.year = buf.read_i32();
+                    entry->info.month = buf.read_i32();
+                    entry->info.population = buf.read_i32();
+                    entry->info.treasury = buf.read_i32();
+                    buf.read_raw(entry->info.scenario_name, sizeof(entry->info.scenario_name));
+                }
+                data.num_entries = count;
+            }
+        }
+    }
+    file_close(fp);
+}
+
+static void save_index(void) {
+    buffer buf(INDEX_HEADER_SIZE + data.num_entries * INDEX_ENTRY_SIZE);
+    buf.write_raw(INDEX_MAGIC, 4);
+    buf.write_i32(INDEX_VERSION);
+    buf.write_i32(data.num_entries);
+    for (int i = 0; i < data.num_entries; i++) {
+        const index_entry *entry = &data.entries[i];
+        buf.write_raw(entry->filename, FILE_NAME_MAX);
+        buf.write_i32(entry->size);
+        buf.write_u32((uint32_t) ((uint64_t) entry->mtime & 0xffffffff));
+        buf.write_u32((uint32_t) ((uint64_t) entry->mtime >> 32));
+        buf.write_u8(entry->has_info);
+        buf.write_i32(entry->info.mission);
+        buf.write_i32(entry->info.year);
+        buf.write_i32(entry->info.month);
+        buf.write_i32(entry->info.population);
+        buf.write_i32(entry->info.treasury);
+        buf.write_raw(entry->info.scenario_name, sizeof(entry->info.scenario_name));
+    }
+
+    char path[FILE_NAME_MAX];
+    get_path(INDEX_FILENAME, path);
+    FILE *fp = file_open(path, "wb");
+    if (!fp) {
+        log_error("Unable to write saved game index", path, 0);
+        return;
+    }
+    buf.to_file(buf.size(), fp);
+    file_close(fp);
+}
+
+void game_save_index_refresh(const char *dir, const dir_listing *files) {
+    if (strcmp(data.dir, dir) != 0 || !data.entries) {
+        game_save_index_flush();
+        strncpy(data.dir, dir, FILE_NAME_MAX - 1);
+        load_index();
+    }
+
+    // build the new entry list from the listing, reusing entries whose file is unchanged
+    index_entry *entries = (index_entry *) malloc((files->num_files + 1) * sizeof(index_entry));
+    int changed = data.is_dirty || files->num_files != data.num_entries;
+    for (int i = 0; i < files->num_files; i++) {
+        index_entry *entry = &entries[i];
+        char path[FILE_NAME_MAX];
+        get_path(files->files[i], path);
+        long size = 0;
+        long long mtime = 0;
+        platform_file_manager_get_file_info(path, &size, &mtime);
+
+        const index_entry *cached = find_entry(data.entries, data.num_entries, files->files[i]);
+        if (cached && cached->size == size && cached->mtime == mtime) {
+            *entry = *cached;
+            continue;
+        }
+        memset(entry, 0, sizeof(index_entry));
+        strncpy(entry->filename, files->files[i], FILE_NAME_MAX - 1);
+        entry->size = size;
+        entry->mtime = mtime;
+        // saves without a summary section are only read when their summary is asked for
+        entry->has_info = game_file_io_read_saved_game_info(path, &entry->info) ? INFO_AVAILABLE : INFO_NOT_READ;
+        changed = 1;
+    }
+    free(data.entries);
+    data.entries = entries;
+    data.num_entries = files->num_files;
+    data.max_entries = files->num_files + 1;
+
+    data.is_dirty = changed;
+    game_save_index_flush();
+}
+
+const saved_game_info *game_save_index_get(const char *filename) {
+    index_entry *entry = find_entry(data.entries, data.num_entries, filename);
+    if (!entry)
+        return 0;
+    return entry->has_info == INFO_AVAILABLE ? &entry->info : 0;
+}
+
+void game_save_index_read_info(const char *filename) {
+    index_entry *entry = find_entry(data.entries, data.num_entries, filename);
+    if (!entry || entry->has_info != INFO_NOT_READ)
+        return;
+    char path[FILE_NAME_MAX];
+    get_path(entry->filename, path);
+    entry->has_info = game_file_io_read_legacy_saved_game_info(path, &entry->info) ? INFO_AVAILABLE : INFO_MISSING;
+    data.is_dirty = 1;
+}
+
+void game_save_index_flush(void) {
+    if (data.is_dirty)
+        save_index();
+    data.is_dirty = 0;
+}
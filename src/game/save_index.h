@@ -0,0 +1,44 @@
+#ifndef GAME_SAVE_INDEX_H
+#define GAME_SAVE_INDEX_H
+
+#include "core/dir.h"
+#include "game/file_io.h"
+
+/**
+ * @file
+ * Persistent cache of saved game summaries, used by the file dialog.
+ *
+ * Entries are keyed by filename, size and modification time and are stored in
+ * an index file next to the saved games, so listing a directory does not
+ * require opening every save.
+ */
+
+/**
+ * Brings the index for the directory up to date with the given listing.
+ * Only files that are new or have changed since the last refresh are read.
+ * @param dir Directory containing the files, "." for the base directory
+ * @param files Files currently in the directory
+ */
+void game_save_index_refresh(const char *dir, const dir_listing *files);
+
+/**
+ * Gets the cached summary of a saved game. Only reads the cache, so it is safe to call while drawing.
+ * @param filename Filename as it appears in the directory listing
+ * @return Summary, or null if the file is unknown, its summary can't be read or has not been read yet
+ */
+const saved_game_info *game_save_index_get(const char *filename);
+
+/**
+ * Reads the summary of a saved game in the original format, which has no summary section,
+ * from the whole file. Does nothing if the summary was read before.
+ * The index file is not written until the next flush.
+ * @param filename Filename as it appears in the directory listing
+ */
+void game_save_index_read_info(const char *filename);
+
+/**
+ * Writes the index file if summaries were read since it was last written
+ */
+void game_save_index_flush(void);
+
+#endif // GAME_SAVE_INDEX_H
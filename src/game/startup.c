@@ -0,0 +1,40 @@
+#include "startup.h"
+
+#include "core/log.h"
+#include "platform/platform.h"
+
+#include <stdio.h>
+
+static struct {
+    int started;
+    unsigned int start_millis;
+    unsigned int stage_millis;
+    const char *stage;
+} data;
+
+static void end_stage(unsigned int now) {
+    if (!data.stage)
+        return;
+    char message[100];
+    snprintf(message, sizeof(message), "Startup: %u ms at %u ms -", now - data.stage_millis,
+             data.stage_millis - data.start_millis);
+    log_info(message, data.stage, 0);
+    data.stage = 0;
+}
+
+void game_startup_stage(const char *name) {
+    unsigned int now = platform_get_millis();
+    if (!data.started) {
+        data.started = 1;
+        data.start_millis = now;
+    }
+    end_stage(now);
+    data.stage = name;
+    data.stage_millis = now;
+}
+
+void game_startup_done(void) {
+    unsigned int now = platform_get_millis();
+    end_stage(now);
+    log_info("Startup: total ms", 0, (int) (now - data.start_millis));
+}
@@ -0,0 +1,20 @@
+#ifndef GAME_STARTUP_H
+#define GAME_STARTUP_H
+
+/**
+ * @file
+ * Timeline of the startup stages, written to the log.
+ */
+
+/**
+ * Starts a startup stage. The previous stage, if any, ends here and its duration is logged.
+ * @param name Name of the stage, must stay valid until the next stage starts
+ */
+void game_startup_stage(const char *name);
+
+/**
+ * Ends the last stage and logs the total startup time
+ */
+void game_startup_done(void);
+
+#endif // GAME_STARTUP_H
@@ -26,12 +26,16 @@
 #include "city/sentiment.h"
 #include "city/trade.h"
 #include "city/victory.h"
+#include "core/config.h"
 #include "core/random.h"
 #include "editor/editor.h"
 #include "empire/city.h"
+#include "figure/action.h"
 #include "figure/formation.h"
 #include "figuretype/crime.h"
+#include "game/fast_forward.h"
 #include "game/file.h"
+#include "game/forecast.h"
 #include "game/settings.h"
 #include "game/time.h"
 #include "game/tutorial.h"
@@ -55,6 +59,9 @@
 #include "sound/music.h"
 #include "widget/minimap.h"
 
+// new walker routes computed per tick when route searches are spread out
+#define MAX_ROUTES_PER_TICK 50
+
 static void advance_year(void) {
     scenario_empire_process_expansion();
     game_undo_disable();
@@ -98,7 +105,7 @@ static void advance_month(void) {
     city_population_record_monthly();
     city_festival_update();
     tutorial_on_month_tick();
-    if (setting_monthly_autosave())
+    if (setting_monthly_autosave() && !game_forecast_is_running())
         game_file_write_saved_game("autosave.svx");
 
 }
@@ -128,10 +135,12 @@ static void advance_tick(void) {
             city_gods_calculate_moods(1);
             break;
         case 2:
-            sound_music_update(0);
+            if (!game_forecast_is_running())
+                sound_music_update(0);
             break;
         case 3:
-            widget_minimap_invalidate();
+            if (!game_fast_forward_is_active())
+                widget_minimap_invalidate();
             break;
         case 4:
             city_emperor_update();
@@ -199,7 +208,8 @@ static void advance_tick(void) {
             formation_update_all(1);
             break;
         case 30:
-            widget_minimap_invalidate();
+            if (!game_fast_forward_is_active())
+                widget_minimap_invalidate();
             break;
         case 31:
             building_figure_generate();
@@ -268,6 +278,7 @@ void game_tick_run(void) {
     random_generate_next();
     game_undo_reduce_time_available();
     advance_tick();
+    figure_action_set_route_budget(config_get(CONFIG_GP_CH_LIMIT_ROUTES_PER_TICK) ? MAX_ROUTES_PER_TICK : 0);
     figure_action_handle();
     scenario_earthquake_process();
     scenario_gladiator_revolt_process();
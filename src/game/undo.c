@@ -12,6 +12,8 @@
 #include "map/aqueduct.h"
 #include "map/building.h"
 #include "map/building_tiles.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/grid.h"
 #include "map/image.h"
 #include "map/property.h"
@@ -34,14 +36,21 @@ static struct {
     building buildings[MAX_UNDO_BUILDINGS];
     int newhouses_offsets[MAX_UNDO_BUILDINGS];
     int newhouses_num;
+    int held;
 } data;
 
 int game_can_undo(void) {
     return data.ready && data.available;
 }
 void game_undo_disable(void) {
+    if (data.held)
+        return;
     data.available = 0;
 }
+void game_undo_hold(int hold) {
+    // while held, the simulation running ahead can't expire or drop the player's last action
+    data.held = hold;
+}
 void game_undo_add_building(building *b) {
     if (b->id <= 0)
         return;
@@ -122,6 +131,8 @@ void game_undo_restore_building_state(void) {
             if (b->state == BUILDING_STATE_DELETED_BY_PLAYER)
                 b->state = BUILDING_STATE_VALID;
             b->is_deleted = 0;
+            map_desirability_building_changed(b->id);
+            map_water_supply_building_changed(b->id);
         }
     }
     clear_buildings();
@@ -190,6 +201,8 @@ static void add_building_to_terrain(building *b) {
             b->data.industry.fishing_boat_id = 0;
     }
     b->state = BUILDING_STATE_VALID;
+    map_desirability_building_changed(b->id);
+    map_water_supply_building_changed(b->id);
 
     while (b->prev_part_building_id)
         b = building_get(b->prev_part_building_id);
@@ -297,6 +310,8 @@ void game_undo_perform(void) {
                     building_warehouses_add_resource(RESOURCE_MARBLE_C3, 2);
 
                 b->state = BUILDING_STATE_UNDO;
+                map_desirability_building_changed(b->id);
+                map_water_supply_building_changed(b->id);
             }
         }
     }
@@ -321,7 +336,7 @@ void game_undo_perform(void) {
     }
 }
 void game_undo_reduce_time_available(void) {
-    if (!game_can_undo())
+    if (data.held || !game_can_undo())
         return;
     if (data.timeout_ticks <= 0 || scenario_earthquake_is_in_progress()) {
         data.available = 0;
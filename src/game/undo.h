@@ -7,6 +7,8 @@ int game_can_undo(void);
 
 void game_undo_disable(void);
 
+void game_undo_hold(int hold);
+
 void game_undo_add_building(building *b);
 
 void game_undo_adjust_building(building *b);
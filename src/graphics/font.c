@@ -1,8 +1,11 @@
 #include "font.h"
 
 #include "core/encoding_trad_chinese.h"
+#include "core/game_images.h"
 #include "core/image.h"
 
+#include <string.h>
+
 static int image_y_offset_none(uint8_t c, int image_height, int line_height);
 static int image_y_offset_default(uint8_t c, int image_height, int line_height);
 static int image_y_offset_eastern(uint8_t c, int image_height, int line_height);
@@ -160,6 +163,9 @@ static struct {
     const int *font_mapping;
     const font_definition *font_definitions;
     int multibyte;
+    font_glyph glyphs[FONT_TYPES_MAX][256];
+    uint8_t glyph_cached[FONT_TYPES_MAX][256];
+    font_glyph multibyte_glyph;
 } data;
 
 static int image_y_offset_none(uint8_t c, int image_height, int line_height) {
@@ -346,6 +352,7 @@ static int image_y_offset_korean(uint8_t c, int image_height, int line_height) {
 }
 
 void font_set_encoding(encoding_type encoding) {
+    memset(data.glyph_cached, 0, sizeof(data.glyph_cached));
     data.multibyte = MULTIBYTE_NONE;
     if (encoding == ENCODING_EASTERN_EUROPE) {
         data.font_mapping = CHAR_TO_FONT_IMAGE_EASTERN;
@@ -419,3 +426,32 @@ int font_letter_id(const font_definition *def, const uint8_t *str, int *num_byte
         return data.font_mapping[*str] + def->image_offset - 1;
     }
 }
+
+static void fill_glyph(font_glyph *glyph, const font_definition *def, const uint8_t *str, int *num_bytes) {
+    glyph->letter_id = font_letter_id(def, str, num_bytes);
+    glyph->width = 0;
+    glyph->y_offset = 0;
+    if (glyph->letter_id >= 0) {
+        const image *img = image_letter(glyph->letter_id);
+        glyph->width = img->get_width();
+        glyph->y_offset = def->image_y_offset(*str, img->get_height(), def->line_height);
+    }
+}
+
+const font_glyph *font_glyph_for(const font_definition *def, const uint8_t *str, int *num_bytes) {
+    if (data.multibyte != MULTIBYTE_NONE && *str >= 0x80) {
+        fill_glyph(&data.multibyte_glyph, def, str, num_bytes);
+        return &data.multibyte_glyph;
+    }
+    font_glyph *glyph = &data.glyphs[def->font][*str];
+    if (data.glyph_cached[def->font][*str]) {
+        *num_bytes = 1;
+        return glyph;
+    }
+    fill_glyph(glyph, def, str, num_bytes);
+    // letters looked up before the font images are loaded have no size yet: try again later
+    if (glyph->letter_id < 0 || glyph->width > 0)
+        data.glyph_cached[def->font][*str] = 1;
+
+    return glyph;
+}
@@ -66,4 +66,23 @@ int font_can_display(const uint8_t *character);
  */
 int font_letter_id(const font_definition *def, const uint8_t *str, int *num_bytes);
 
+/**
+ * Letter metrics, as used for measuring and drawing text
+ */
+typedef struct {
+    int letter_id; /**< Letter ID, or -1 if the character has no letter */
+    int width; /**< Width of the letter image, without letter spacing */
+    int y_offset; /**< Offset to subtract from the y coordinate when drawing */
+} font_glyph;
+
+/**
+ * Gets the metrics for the character at the start of the string. Single-byte characters
+ * are looked up once per font and kept until the encoding changes.
+ * @param def Font definition
+ * @param str Character string
+ * @param num_bytes Out: number of bytes consumed by letter
+ * @return Glyph, only valid until the next call for a multibyte character
+ */
+const font_glyph *font_glyph_for(const font_definition *def, const uint8_t *str, int *num_bytes);
+
 #endif // GRAPHICS_FONT_H
@@ -799,40 +799,174 @@ void image_draw_blend_alpha(int image_id, int x, int y, color_t color) {
         draw_uncompressed(img, data, x, y, color, DRAW_TYPE_BLEND_ALPHA);
     }
 }
-static void draw_multibyte_letter(font_t font, const image *img, const color_t *data, int x, int y, color_t color) {
+// multibyte letters are tinted and combined with their shadow once, then drawn in a single pass
+#define GLYPH_ATLAS_PIXELS (1024 * 1024)
+#define GLYPH_CACHE_SLOTS 8192
+
+typedef struct {
+    int in_use;
+    int letter_id;
+    font_t font;
+    color_t color;
+    const color_t *source;
+    int y_offset;
+    int width;
+    int height;
+    int pixel_offset;
+} baked_glyph;
+
+static struct {
+    color_t pixels[GLYPH_ATLAS_PIXELS];
+    int used_pixels;
+    baked_glyph glyphs[GLYPH_CACHE_SLOTS];
+    int num_glyphs;
+} glyph_atlas;
+
+static int get_multibyte_letter_colors(font_t font, color_t color, color_t *shadow, color_t *main, int *y_offset) {
+    *y_offset = 0;
     switch (font) {
         case FONT_NORMAL_WHITE:
-            draw_uncompressed(img, data, x + 1, y + 1, 0x311c10, DRAW_TYPE_BLEND_ALPHA);
-            draw_uncompressed(img, data, x, y, COLOR_WHITE, DRAW_TYPE_BLEND_ALPHA);
-            break;
+            *shadow = 0x311c10;
+            *main = COLOR_WHITE;
+            return 1;
         case FONT_NORMAL_RED:
-            draw_uncompressed(img, data, x + 1, y + 1, 0xe7cfad, DRAW_TYPE_BLEND_ALPHA);
-            draw_uncompressed(img, data, x, y, 0x731408, DRAW_TYPE_BLEND_ALPHA);
-            break;
+            *shadow = 0xe7cfad;
+            *main = 0x731408;
+            return 1;
         case FONT_NORMAL_GREEN:
-            draw_uncompressed(img, data, x + 1, y + 1, 0xe7cfad, DRAW_TYPE_BLEND_ALPHA);
-            draw_uncompressed(img, data, x, y, 0x311c10, DRAW_TYPE_BLEND_ALPHA);
-            break;
+            *shadow = 0xe7cfad;
+            *main = 0x311c10;
+            return 1;
         case FONT_NORMAL_PLAIN:
-            draw_uncompressed(img, data, x, y + 2, color, DRAW_TYPE_BLEND_ALPHA);
-            break;
+            *main = color;
+            *y_offset = 2;
+            return 0;
         case FONT_NORMAL_BLACK:
         case FONT_LARGE_BLACK:
-            draw_uncompressed(img, data, x + 1, y + 1, 0xcead9c, DRAW_TYPE_BLEND_ALPHA);
-            draw_uncompressed(img, data, x, y, color, DRAW_TYPE_BLEND_ALPHA);
-            break;
+            *shadow = 0xcead9c;
+            *main = color;
+            return 1;
         default:
-            draw_uncompressed(img, data, x, y, color, DRAW_TYPE_BLEND_ALPHA);
-            break;
+            *main = color;
+            return 0;
     }
 }
+static int letter_alpha(const image *img, const color_t *data, int x, int y) {
+    if (x < 0 || y < 0 || x >= img->get_width() || y >= img->get_height())
+        return 0;
+    color_t pixel = data[y * img->get_width() + x];
+    return pixel == COLOR_SG2_TRANSPARENT ? 0 : COLOR_COMPONENT(pixel, COLOR_BITSHIFT_ALPHA);
+}
+static color_t composite_channel(color_t shadow, color_t main, int shadow_alpha, int main_alpha, int alpha, int shift) {
+    int s = COLOR_COMPONENT(shadow, shift);
+    int m = COLOR_COMPONENT(main, shift);
+    int value = (s * shadow_alpha * (255 - main_alpha) + m * main_alpha * 255) / (alpha * 255);
+    return (color_t) (value > 255 ? 255 : value) << shift;
+}
+static void bake_glyph(baked_glyph *glyph, const image *img, const color_t *data, color_t color) {
+    color_t shadow = 0;
+    color_t main = 0;
+    int has_shadow = get_multibyte_letter_colors(glyph->font, color, &shadow, &main, &glyph->y_offset);
+    glyph->width = img->get_width() + has_shadow;
+    glyph->height = img->get_height() + has_shadow;
+    color_t *dst = &glyph_atlas.pixels[glyph->pixel_offset];
+    for (int y = 0; y < glyph->height; y++) {
+        for (int x = 0; x < glyph->width; x++, dst++) {
+            int main_alpha = letter_alpha(img, data, x, y);
+            int shadow_alpha = has_shadow ? letter_alpha(img, data, x - 1, y - 1) : 0;
+            // same result as drawing the shadow first and the letter over it
+            int alpha = 255 - (255 - shadow_alpha) * (255 - main_alpha) / 255;
+            if (!alpha) {
+                *dst = ALPHA_TRANSPARENT;
+                continue;
+            }
+            *dst = ((color_t) alpha << COLOR_BITSHIFT_ALPHA) |
+                   composite_channel(shadow, main, shadow_alpha, main_alpha, alpha, 16) |
+                   composite_channel(shadow, main, shadow_alpha, main_alpha, alpha, 8) |
+                   composite_channel(shadow, main, shadow_alpha, main_alpha, alpha, 0);
+        }
+    }
+}
+static void clear_glyph_atlas(void) {
+    memset(glyph_atlas.glyphs, 0, sizeof(glyph_atlas.glyphs));
+    glyph_atlas.num_glyphs = 0;
+    glyph_atlas.used_pixels = 0;
+}
+static const baked_glyph *get_baked_glyph(font_t font, int letter_id, const image *img, const color_t *data, color_t color) {
+    // fonts with fixed colors ignore the requested one
+    color_t shadow, main;
+    int y_offset;
+    get_multibyte_letter_colors(font, color, &shadow, &main, &y_offset);
+    color = main;
+    unsigned int hash = (unsigned int) letter_id * 2654435761u ^ (unsigned int) font * 40503u ^ color;
+    int slot = hash & (GLYPH_CACHE_SLOTS - 1);
+    while (glyph_atlas.glyphs[slot].in_use) {
+        baked_glyph *glyph = &glyph_atlas.glyphs[slot];
+        if (glyph->letter_id == letter_id && glyph->font == font && glyph->color == color && glyph->source == data)
+            return glyph;
+        slot = (slot + 1) & (GLYPH_CACHE_SLOTS - 1);
+    }
+    int num_pixels = (img->get_width() + 1) * (img->get_height() + 1);
+    if (num_pixels > GLYPH_ATLAS_PIXELS)
+        return 0;
+    if (glyph_atlas.used_pixels + num_pixels > GLYPH_ATLAS_PIXELS ||
+        glyph_atlas.num_glyphs >= GLYPH_CACHE_SLOTS * 3 / 4) {
+        clear_glyph_atlas();
+        slot = hash & (GLYPH_CACHE_SLOTS - 1);
+    }
+    baked_glyph *glyph = &glyph_atlas.glyphs[slot];
+    glyph->in_use = 1;
+    glyph->letter_id = letter_id;
+    glyph->font = font;
+    glyph->color = color;
+    glyph->source = data;
+    glyph->pixel_offset = glyph_atlas.used_pixels;
+    bake_glyph(glyph, img, data, color);
+    glyph_atlas.used_pixels += glyph->width * glyph->height;
+    glyph_atlas.num_glyphs++;
+    return glyph;
+}
+static void draw_baked_glyph(const baked_glyph *glyph, int x_offset, int y_offset) {
+    y_offset += glyph->y_offset;
+    const clip_info *clip = graphics_get_clip_info(x_offset, y_offset, glyph->width, glyph->height);
+    if (!clip->is_visible)
+        return;
+    int x_max = glyph->width - clip->clipped_pixels_right;
+    for (int y = clip->clipped_pixels_top; y < glyph->height - clip->clipped_pixels_bottom; y++) {
+        const color_t *src = &glyph_atlas.pixels[glyph->pixel_offset + y * glyph->width + clip->clipped_pixels_left];
+        color_t *dst = graphics_get_pixel(x_offset + clip->clipped_pixels_left, y_offset + y);
+        for (int x = clip->clipped_pixels_left; x < x_max; x++, dst++, src++) {
+            color_t alpha = COLOR_COMPONENT(*src, COLOR_BITSHIFT_ALPHA);
+            if (alpha == 255)
+                *dst = *src;
+            else if (alpha)
+                *dst = COLOR_BLEND_ALPHA_TO_OPAQUE(*src, *dst, alpha);
+        }
+    }
+}
+static void draw_multibyte_letter(font_t font, int letter_id, const image *img, const color_t *data, int x, int y, color_t color) {
+    if (img->get_type() != IMAGE_TYPE_MOD) {
+        const baked_glyph *glyph = get_baked_glyph(font, letter_id, img, data, color);
+        if (glyph) {
+            draw_baked_glyph(glyph, x, y);
+            return;
+        }
+    }
+    color_t shadow = 0;
+    color_t main = 0;
+    int y_offset;
+    if (get_multibyte_letter_colors(font, color, &shadow, &main, &y_offset))
+        draw_uncompressed(img, data, x + 1, y + 1, shadow, DRAW_TYPE_BLEND_ALPHA);
+
+    draw_uncompressed(img, data, x, y + y_offset, main, DRAW_TYPE_BLEND_ALPHA);
+}
 void image_draw_letter(font_t font, int letter_id, int x, int y, color_t color) {
     const image *img = image_letter(letter_id);
     const color_t *data = image_data_letter(letter_id);
     if (!data)
         return;
     if (letter_id >= IMAGE_FONT_MULTIBYTE_OFFSET) {
-        draw_multibyte_letter(font, img, data, x, y, color);
+        draw_multibyte_letter(font, letter_id, img, data, x, y, color);
         return;
     }
 
@@ -149,9 +149,9 @@ static int get_word_width(const uint8_t *str, int in_link, int *num_chars) {
             width += 4;
         } else if (*str > ' ') {
             // normal char
-            int letter_id = font_letter_id(normal_font_def, str, &num_bytes);
-            if (letter_id >= 0)
-                width += 1 + image_letter(letter_id)->get_width();
+            const font_glyph *glyph = font_glyph_for(normal_font_def, str, &num_bytes);
+            if (glyph->letter_id >= 0)
+                width += 1 + glyph->width;
 
             word_char_seen = 1;
             if (num_bytes > 1) {
@@ -192,8 +192,8 @@ static void draw_line(const uint8_t *str, int x, int y, color_t color, int measu
 
 
             int num_bytes = 1;
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id < 0)
+            const font_glyph *glyph = font_glyph_for(def, str, &num_bytes);
+            if (glyph->letter_id < 0)
                 x += def->space_width;
             else {
                 if (num_bytes > 1 && start_link) {
@@ -201,12 +201,10 @@ static void draw_line(const uint8_t *str, int x, int y, color_t color, int measu
                     x += def->space_width;
                     start_link = 0;
                 }
-                const image *img = image_letter(letter_id);
-                if (!measure_only) {
-                    int height = def->image_y_offset(*str, img->get_height(), def->line_height);
-                    image_draw_letter(def->font, letter_id, x, y - height, color);
-                }
-                x += img->get_width() + def->letter_spacing;
+                if (!measure_only)
+                    image_draw_letter(def->font, glyph->letter_id, x, y - glyph->y_offset, color);
+
+                x += glyph->width + def->letter_spacing;
             }
             if (num_link_chars > 0)
                 num_link_chars -= num_bytes;
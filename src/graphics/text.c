@@ -4,7 +4,6 @@
 #include "core/string.h"
 #include "core/time.h"
 #include "core/game_environment.h"
-#include "core/game_images.h"
 #include "graphics/graphics.h"
 #include "graphics/image.h"
 
@@ -12,6 +11,8 @@
 
 #define ELLIPSIS_LENGTH 4
 #define NUMBER_BUFFER_LENGTH 100
+#define MAX_LAYOUT_LINES 100
+#define LAYOUT_CACHE_SIZE 16
 
 static uint8_t tmp_line[200];
 
@@ -29,6 +30,27 @@ static struct {
     int text_offset_end;
 } input_cursor;
 
+typedef struct {
+    int start;
+    int length;
+} text_line;
+
+// line breaks of recently drawn multiline texts, so that dialogs do not measure every word on every frame
+typedef struct {
+    const uint8_t *str;
+    uint32_t hash;
+    const font_definition *def;
+    int box_width;
+    unsigned int last_used;
+    int num_lines;
+    text_line lines[MAX_LAYOUT_LINES];
+} text_layout;
+
+static struct {
+    text_layout entries[LAYOUT_CACHE_SIZE];
+    unsigned int use_counter;
+} layout_cache;
+
 static struct {
     const uint8_t string[ELLIPSIS_LENGTH];
     int width[FONT_TYPES_MAX];
@@ -92,9 +114,9 @@ int text_get_width(const uint8_t *str, font_t font) {
         if (*str == ' ')
             width += def->space_width;
         else {
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id >= 0)
-                width += def->letter_spacing + image_letter(letter_id)->get_width();
+            const font_glyph *glyph = font_glyph_for(def, str, &num_bytes);
+            if (glyph->letter_id >= 0)
+                width += def->letter_spacing + glyph->width;
 
         }
         str += num_bytes;
@@ -108,9 +130,9 @@ static int get_letter_width(const uint8_t *str, const font_definition *def, int
     if (*str == ' ')
         return def->space_width;
 
-    int letter_id = font_letter_id(def, str, num_bytes);
-    if (letter_id >= 0)
-        return def->letter_spacing + image_letter(letter_id)->get_width();
+    const font_glyph *glyph = font_glyph_for(def, str, num_bytes);
+    if (glyph->letter_id >= 0)
+        return def->letter_spacing + glyph->width;
     else {
         return 0;
     }
@@ -169,9 +191,9 @@ void text_ellipsize(uint8_t *str, font_t font, int requested_width) {
         if (*str == ' ')
             width += def->space_width;
         else {
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id >= 0)
-                width += def->letter_spacing + image_letter(letter_id)->get_width();
+            const font_glyph *glyph = font_glyph_for(def, str, &num_bytes);
+            if (glyph->letter_id >= 0)
+                width += def->letter_spacing + glyph->width;
 
         }
         if (ellipsis_width + width <= requested_width)
@@ -207,9 +229,9 @@ static int get_word_width(const uint8_t *str, font_t font, int *out_num_chars) {
 
         } else if (*str > ' ') {
             // normal char
-            int letter_id = font_letter_id(def, str, &num_bytes);
-            if (letter_id >= 0)
-                width += image_letter(letter_id)->get_width() + def->letter_spacing;
+            const font_glyph *glyph = font_glyph_for(def, str, &num_bytes);
+            if (glyph->letter_id >= 0)
+                width += glyph->width + def->letter_spacing;
 
             word_char_seen = 1;
             if (num_bytes > 1) {
@@ -255,15 +277,13 @@ int text_draw(const uint8_t *str, int x, int y, font_t font, color_t color) {
         int num_bytes = 1;
 
         if (*str >= ' ') {
-            int letter_id = font_letter_id(def, str, &num_bytes);
+            const font_glyph *glyph = font_glyph_for(def, str, &num_bytes);
             int width;
-            if (*str == ' ' || *str == '_' || letter_id < 0)
+            if (*str == ' ' || *str == '_' || glyph->letter_id < 0)
                 width = def->space_width;
             else {
-                const image *img = image_letter(letter_id);
-                int height = def->image_y_offset(*str, img->get_height(), def->line_height);
-                image_draw_letter(def->font, letter_id, current_x, y - height, color);
-                width = def->letter_spacing + img->get_width();
+                image_draw_letter(def->font, glyph->letter_id, current_x, y - glyph->y_offset, color);
+                width = def->letter_spacing + glyph->width;
             }
             if (input_cursor.capture && input_cursor.position == input_cursor.cursor_position) {
                 if (!input_cursor.seen) {
@@ -367,24 +387,19 @@ text_draw_number_centered_colored(int value, int x_offset, int y_offset, int box
     text_draw_centered(str, x_offset, y_offset, box_width, font, color);
 }
 
-int text_draw_multiline(const uint8_t *str, int x_offset, int y_offset, int box_width, font_t font, uint32_t color) {
-    int line_height = font_definition_for(font)->line_height;
-    if (line_height < 11)
-        line_height = 11;
-
+static void layout_multiline(const uint8_t *str, int box_width, font_t font, text_layout *layout) {
+    const uint8_t *text = str;
     int has_more_characters = 1;
     int guard = 0;
-    int y = y_offset;
+    layout->num_lines = 0;
     while (has_more_characters) {
-        if (++guard >= 100)
+        if (++guard >= MAX_LAYOUT_LINES)
             break;
 
-        // clear line
-        for (int i = 0; i < 200; i++) {
-            tmp_line[i] = 0;
-        }
+        text_line *line = &layout->lines[layout->num_lines++];
+        line->start = (int) (str - text);
+        line->length = 0;
         int current_width = 0;
-        int line_index = 0;
         while (has_more_characters && current_width < box_width) {
             int word_num_chars;
             int word_width = get_word_width(str, font, &word_num_chars);
@@ -395,11 +410,12 @@ int text_draw_multiline(const uint8_t *str, int x_offset, int y_offset, int box_
 
             } else {
                 for (int i = 0; i < word_num_chars; i++) {
-                    if (line_index == 0 && *str <= ' ')
-                        str++; // skip whitespace at start of line
+                    if (line->length == 0 && *str <= ' ')
+                        line->start++; // skip whitespace at start of line
                     else {
-                        tmp_line[line_index++] = *str++;
+                        line->length++;
                     }
+                    str++;
                 }
                 if (!*str)
                     has_more_characters = 0;
@@ -409,6 +425,51 @@ int text_draw_multiline(const uint8_t *str, int x_offset, int y_offset, int box_
                 }
             }
         }
+    }
+}
+
+static uint32_t hash_string(const uint8_t *str) {
+    uint32_t hash = 2166136261u;
+    while (*str) {
+        hash = (hash ^ *str++) * 16777619u;
+    }
+    return hash;
+}
+
+static const text_layout *get_multiline_layout(const uint8_t *str, int box_width, font_t font) {
+    const font_definition *def = font_definition_for(font);
+    uint32_t hash = hash_string(str);
+    text_layout *oldest = &layout_cache.entries[0];
+    for (int i = 0; i < LAYOUT_CACHE_SIZE; i++) {
+        text_layout *layout = &layout_cache.entries[i];
+        if (layout->str == str && layout->hash == hash && layout->def == def && layout->box_width == box_width) {
+            layout->last_used = ++layout_cache.use_counter;
+            return layout;
+        }
+        if (layout->last_used < oldest->last_used)
+            oldest = layout;
+    }
+    layout_multiline(str, box_width, font, oldest);
+    oldest->str = str;
+    oldest->hash = hash;
+    oldest->def = def;
+    oldest->box_width = box_width;
+    oldest->last_used = ++layout_cache.use_counter;
+    return oldest;
+}
+
+int text_draw_multiline(const uint8_t *str, int x_offset, int y_offset, int box_width, font_t font, uint32_t color) {
+    int line_height = font_definition_for(font)->line_height;
+    if (line_height < 11)
+        line_height = 11;
+
+    const text_layout *layout = get_multiline_layout(str, box_width, font);
+    int y = y_offset;
+    for (int i = 0; i < layout->num_lines; i++) {
+        const text_line *line = &layout->lines[i];
+        int length = line->length < (int) sizeof(tmp_line) - 1 ? line->length : (int) sizeof(tmp_line) - 1;
+        memcpy(tmp_line, &str[line->start], length);
+        tmp_line[length] = 0;
         text_draw(tmp_line, x_offset, y, font, color);
         y += line_height + 5;
     }
@@ -416,33 +477,5 @@ int text_draw_multiline(const uint8_t *str, int x_offset, int y_offset, int box_
 }
 
 int text_measure_multiline(const uint8_t *str, int box_width, font_t font) {
-    int has_more_characters = 1;
-    int guard = 0;
-    int num_lines = 0;
-    while (has_more_characters) {
-        if (++guard >= 100)
-            break;
-
-        int current_width = 0;
-        while (has_more_characters && current_width < box_width) {
-            int word_num_chars;
-            int word_width = get_word_width(str, font, &word_num_chars);
-            current_width += word_width;
-            if (current_width >= box_width) {
-                if (current_width == 0)
-                    has_more_characters = 0;
-
-            } else {
-                str += word_num_chars;
-                if (!*str)
-                    has_more_characters = 0;
-                else if (*str == '\n') {
-                    str++;
-                    break;
-                }
-            }
-        }
-        num_lines += 1;
-    }
-    return num_lines;
+    return get_multiline_layout(str, box_width, font)->num_lines;
 }
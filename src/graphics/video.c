@@ -2,14 +2,30 @@
 
 #include "core/dir.h"
 #include "core/file.h"
+#include "core/log.h"
 #include "core/smacker.h"
 #include "core/time.h"
 #include "game/settings.h"
 #include "graphics/graphics.h"
+#include "platform/thread.h"
 #include "sound/device.h"
 #include "sound/music.h"
 #include "sound/speech.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+// frames are decoded ahead of playback on a separate thread; one slot is always the frame on screen
+#define QUEUE_SIZE 4
+
+typedef struct {
+    int status;
+    color_t *pixels;
+    uint8_t *audio;
+    int audio_len;
+    int audio_size;
+} video_frame;
+
 static struct {
     int is_playing;
     int is_ended;
@@ -18,6 +34,7 @@ static struct {
     struct {
         int width;
         int height;
+        int source_height;
         int y_scale;
         int micros_per_frame;
         time_millis start_render_millis;
@@ -29,12 +46,135 @@ static struct {
         int channels;
         int rate;
     } audio;
+    struct {
+        video_frame frames[QUEUE_SIZE];
+        int shown;
+        int count;
+        int quit;
+        platform_thread *thread;
+        platform_mutex *mutex;
+        platform_cond *cond;
+    } queue;
 } data;
 
+static void convert_frame(video_frame *frame) {
+    color_t palette[256];
+    const uint32_t *smk_palette = smacker_get_frame_palette(data.s);
+    for (int i = 0; i < 256; i++) {
+        palette[i] = ALPHA_OPAQUE | smk_palette[i];
+    }
+    const uint8_t *src = smacker_get_frame_video(data.s);
+    color_t *dst = frame->pixels;
+    int num_pixels = data.video.width * data.video.source_height;
+    int i = 0;
+    for (; i + 4 <= num_pixels; i += 4) {
+        dst[i] = palette[src[i]];
+        dst[i + 1] = palette[src[i + 1]];
+        dst[i + 2] = palette[src[i + 2]];
+        dst[i + 3] = palette[src[i + 3]];
+    }
+    for (; i < num_pixels; i++) {
+        dst[i] = palette[src[i]];
+    }
+
+    frame->audio_len = 0;
+    if (data.audio.has_audio) {
+        int audio_len = smacker_get_frame_audio_size(data.s, 0);
+        if (audio_len > frame->audio_size) {
+            uint8_t *audio = (uint8_t *) realloc(frame->audio, audio_len);
+            if (!audio)
+                return;
+            frame->audio = audio;
+            frame->audio_size = audio_len;
+        }
+        if (audio_len > 0) {
+            memcpy(frame->audio, smacker_get_frame_audio(data.s, 0), audio_len);
+            frame->audio_len = audio_len;
+        }
+    }
+}
+
+static void decode_next_frame(int slot) {
+    video_frame *frame = &data.queue.frames[slot];
+    frame->status = smacker_next_frame(data.s);
+    if (frame->status == SMACKER_FRAME_OK)
+        convert_frame(frame);
+}
+
+static int run_decoder(void *unused) {
+    platform_mutex_lock(data.queue.mutex);
+    while (!data.queue.quit) {
+        if (data.queue.count >= QUEUE_SIZE - 1) {
+            platform_cond_wait(data.queue.cond, data.queue.mutex);
+            continue;
+        }
+        // the playback side only touches the shown frame and the ones counted after it
+        int slot = (data.queue.shown + data.queue.count + 1) % QUEUE_SIZE;
+        platform_mutex_unlock(data.queue.mutex);
+
+        decode_next_frame(slot);
+
+        platform_mutex_lock(data.queue.mutex);
+        data.queue.count++;
+        if (data.queue.frames[slot].status != SMACKER_FRAME_OK)
+            break;
+    }
+    platform_mutex_unlock(data.queue.mutex);
+    return 0;
+}
+
+static void start_decoder(void) {
+    data.queue.shown = 0;
+    data.queue.count = 0;
+    data.queue.quit = 0;
+    data.queue.mutex = platform_mutex_create();
+    data.queue.cond = platform_cond_create();
+    if (data.queue.mutex && data.queue.cond)
+        data.queue.thread = platform_thread_create(run_decoder, "video", 0);
+    // without a thread, frames are decoded when they are needed
+}
+
+static void stop_decoder(void) {
+    if (data.queue.thread) {
+        platform_mutex_lock(data.queue.mutex);
+        data.queue.quit = 1;
+        platform_cond_signal(data.queue.cond);
+        platform_mutex_unlock(data.queue.mutex);
+        platform_thread_wait(data.queue.thread);
+        data.queue.thread = 0;
+    }
+    platform_cond_destroy(data.queue.cond);
+    platform_mutex_destroy(data.queue.mutex);
+    data.queue.cond = 0;
+    data.queue.mutex = 0;
+}
+
+static void free_frames(void) {
+    for (int i = 0; i < QUEUE_SIZE; i++) {
+        free(data.queue.frames[i].pixels);
+        free(data.queue.frames[i].audio);
+        memset(&data.queue.frames[i], 0, sizeof(video_frame));
+    }
+}
+
+static int allocate_frames(void) {
+    for (int i = 0; i < QUEUE_SIZE; i++) {
+        data.queue.frames[i].pixels = (color_t *) malloc(sizeof(color_t) * data.video.width * data.video.source_height);
+        if (!data.queue.frames[i].pixels) {
+            log_error("Not enough memory for video frames", 0, 0);
+            free_frames();
+            return 0;
+        }
+    }
+    return 1;
+}
+
 static void close_smk(void) {
     if (data.s) {
+        stop_decoder();
         smacker_close(data.s);
         data.s = 0;
+        free_frames();
     }
 }
 
@@ -56,6 +196,7 @@ static int load_smk(const char *filename) {
 
     data.video.width = width;
     data.video.height = y_scale == SMACKER_Y_SCALE_NONE ? height : height * 2;
+    data.video.source_height = height;
     data.video.y_scale = y_scale;
     data.video.current_frame = 0;
     data.video.micros_per_frame = micros_per_frame;
@@ -72,10 +213,14 @@ static int load_smk(const char *filename) {
         }
     }
 
-    if (smacker_first_frame(data.s) != SMACKER_FRAME_OK) {
-        close_smk();
+    if (!allocate_frames() || smacker_first_frame(data.s) != SMACKER_FRAME_OK) {
+        smacker_close(data.s);
+        data.s = 0;
+        free_frames();
         return 0;
     }
+    convert_frame(&data.queue.frames[0]);
+    start_decoder();
     return 1;
 }
 
@@ -107,11 +252,11 @@ void video_init(void) {
     data.video.start_render_millis = time_get_millis();
 
     if (data.audio.has_audio) {
-        int audio_len = smacker_get_frame_audio_size(data.s, 0);
-        if (audio_len > 0) {
+        const video_frame *frame = &data.queue.frames[0];
+        if (frame->audio_len > 0) {
             sound_device_use_custom_music_player(
                     data.audio.bitdepth, data.audio.channels, data.audio.rate,
-                    smacker_get_frame_audio(data.s, 0), audio_len
+                    frame->audio, frame->audio_len
             );
         }
     }
@@ -138,6 +283,16 @@ void video_shutdown(void) {
     }
 }
 
+static int next_frame_available(void) {
+    if (data.queue.count > 0)
+        return 1;
+    if (data.queue.thread)
+        return 0;
+    decode_next_frame((data.queue.shown + 1) % QUEUE_SIZE);
+    data.queue.count++;
+    return 1;
+}
+
 void video_draw(int x_offset, int y_offset) {
     if (!data.s)
         return;
@@ -145,41 +300,51 @@ void video_draw(int x_offset, int y_offset) {
 
     int frame_no = (now_millis - data.video.start_render_millis) * 1000 / data.video.micros_per_frame;
     int draw_frame = data.video.current_frame == 0;
-    while (frame_no > data.video.current_frame) {
-        if (smacker_next_frame(data.s) != SMACKER_FRAME_OK) {
-            close_smk();
-            data.is_ended = 1;
-            data.is_playing = 0;
-            end_video();
-            return;
+    int has_ended = 0;
+    if (data.queue.mutex)
+        platform_mutex_lock(data.queue.mutex);
+    // when the decoder falls behind, playback waits for it instead of blocking the UI
+    while (frame_no > data.video.current_frame && next_frame_available()) {
+        data.queue.shown = (data.queue.shown + 1) % QUEUE_SIZE;
+        data.queue.count--;
+        const video_frame *frame = &data.queue.frames[data.queue.shown];
+        if (frame->status != SMACKER_FRAME_OK) {
+            has_ended = 1;
+            break;
         }
         data.video.current_frame++;
         draw_frame = 1;
 
-        if (data.audio.has_audio) {
-            int audio_len = smacker_get_frame_audio_size(data.s, 0);
-            if (audio_len > 0)
-                sound_device_write_custom_music_data(smacker_get_frame_audio(data.s, 0), audio_len);
+        if (data.audio.has_audio && frame->audio_len > 0)
+            sound_device_write_custom_music_data(frame->audio, frame->audio_len);
 
-        }
+    }
+    if (data.queue.mutex) {
+        platform_cond_signal(data.queue.cond);
+        platform_mutex_unlock(data.queue.mutex);
+    }
+    if (has_ended) {
+        close_smk();
+        data.is_ended = 1;
+        data.is_playing = 0;
+        end_video();
+        return;
     }
     if (!draw_frame)
         return;
     const clip_info *clip = graphics_get_clip_info(x_offset, y_offset, data.video.width, data.video.height);
     if (!clip->is_visible)
         return;
-    const unsigned char *frame = smacker_get_frame_video(data.s);
-    const uint32_t *pal = smacker_get_frame_palette(data.s);
-    if (frame && pal) {
-        for (int y = clip->clipped_pixels_top; y < clip->visible_pixels_y; y++) {
-            color_t *pixel = graphics_get_pixel(x_offset + clip->clipped_pixels_left,
-                                                y + y_offset + clip->clipped_pixels_top);
-            int video_y = data.video.y_scale == SMACKER_Y_SCALE_NONE ? y : y / 2;
-            const unsigned char *line = frame + (video_y * data.video.width);
-            for (int x = clip->clipped_pixels_left; x < clip->visible_pixels_x; x++) {
-                *pixel = ALPHA_OPAQUE | pal[line[x]];
-                ++pixel;
-            }
-        }
+    const color_t *frame = data.queue.frames[data.queue.shown].pixels;
+    int num_pixels = clip->visible_pixels_x - clip->clipped_pixels_left;
+    if (num_pixels <= 0)
+        return;
+    for (int y = clip->clipped_pixels_top; y < clip->visible_pixels_y; y++) {
+        color_t *pixel = graphics_get_pixel(x_offset + clip->clipped_pixels_left,
+                                            y + y_offset + clip->clipped_pixels_top);
+        // scaled videos show every source line twice
+        int video_y = data.video.y_scale == SMACKER_Y_SCALE_NONE ? y : y / 2;
+        const color_t *line = frame + (video_y * data.video.width);
+        memcpy(pixel, &line[clip->clipped_pixels_left], sizeof(color_t) * num_pixels);
     }
 }
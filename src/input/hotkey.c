@@ -56,6 +56,9 @@ static void add_definition(const hotkey_mapping *mapping) {
         case HOTKEY_TOGGLE_PAUSE:
             def->action = &data.hotkey_state.toggle_pause;
             break;
+        case HOTKEY_TOGGLE_FAST_FORWARD:
+            def->action = &data.hotkey_state.toggle_fast_forward;
+            break;
         case HOTKEY_TOGGLE_OVERLAY:
             def->action = &data.hotkey_state.toggle_overlay;
             break;
@@ -157,6 +160,12 @@ static void add_definition(const hotkey_mapping *mapping) {
         case HOTKEY_SAVE_FILE:
             def->action = &data.hotkey_state.save_file;
             break;
+        case HOTKEY_QUICKSAVE:
+            def->action = &data.hotkey_state.quicksave;
+            break;
+        case HOTKEY_QUICKLOAD:
+            def->action = &data.hotkey_state.quickload;
+            break;
         case HOTKEY_ROTATE_BUILDING:
             def->action = &data.hotkey_state.rotate_building;
             break;
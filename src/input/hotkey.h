@@ -18,11 +18,14 @@ typedef struct {
     int show_overlay;
     int toggle_overlay;
     int toggle_pause;
+    int toggle_fast_forward;
     int toggle_editor_battle_info;
     int set_bookmark;
     int go_to_bookmark;
     int load_file;
     int save_file;
+    int quicksave;
+    int quickload;
     int rotate_building;
     int building;
 } hotkeys;
@@ -2,9 +2,85 @@
 
 #include "building/building.h"
 #include "core/config.h"
+#include "map/data.h"
 #include "map/grid.h"
 
+#include <stdlib.h>
+
+#define SERVICE_AREA_RADIUS 2
+#define SERVICE_AREA_TILES ((2 * SERVICE_AREA_RADIUS + 1) * (2 * SERVICE_AREA_RADIUS + 1))
+
 static grid_xx buildings_grid = {0, {FS_UINT16, FS_UINT16}};
+
+// For each map row, the buildings within the service radius of every tile, stored as one
+// contiguous list per row with the start of each tile's entries in 'start'
+static struct {
+    int valid;
+    int start[GRID_SIZE_PH + 1];
+    uint16_t *ids;
+    int capacity;
+} service_rows[GRID_SIZE_PH];
+
+static void invalidate_service_rows(int grid_offset) {
+    int y = map_grid_offset_to_y(grid_offset);
+    for (int yy = y - SERVICE_AREA_RADIUS; yy <= y + SERVICE_AREA_RADIUS; yy++) {
+        if (yy >= 0 && yy < GRID_SIZE_PH)
+            service_rows[yy].valid = 0;
+    }
+}
+static void invalidate_all_service_rows(void) {
+    for (int y = 0; y < GRID_SIZE_PH; y++)
+        service_rows[y].valid = 0;
+}
+static void build_service_row(int y) {
+    int needed = map_data.width * SERVICE_AREA_TILES;
+    if (service_rows[y].capacity < needed) {
+        uint16_t *ids = (uint16_t *) realloc(service_rows[y].ids, needed * sizeof(uint16_t));
+        if (!ids)
+            return;
+        service_rows[y].ids = ids;
+        service_rows[y].capacity = needed;
+    }
+    int count = 0;
+    for (int x = 0; x < map_data.width; x++) {
+        service_rows[y].start[x] = count;
+        int x_min, y_min, x_max, y_max;
+        map_grid_get_area(x, y, 1, SERVICE_AREA_RADIUS, &x_min, &y_min, &x_max, &y_max);
+        for (int yy = y_min; yy <= y_max; yy++) {
+            for (int xx = x_min; xx <= x_max; xx++) {
+                int building_id = map_building_at(map_grid_offset(xx, yy));
+                if (building_id)
+                    service_rows[y].ids[count++] = building_id;
+            }
+        }
+    }
+    service_rows[y].start[map_data.width] = count;
+    service_rows[y].valid = 1;
+}
+const uint16_t *map_building_service_area(int x, int y, int *count) {
+    if (x >= 0 && x < map_data.width && y >= 0 && y < map_data.height && y < GRID_SIZE_PH) {
+        if (!service_rows[y].valid)
+            build_service_row(y);
+        if (service_rows[y].valid) {
+            int start = service_rows[y].start[x];
+            *count = service_rows[y].start[x + 1] - start;
+            return &service_rows[y].ids[start];
+        }
+    }
+    // not on the map: collect the buildings directly
+    static uint16_t scratch[SERVICE_AREA_TILES];
+    int x_min, y_min, x_max, y_max;
+    map_grid_get_area(x, y, 1, SERVICE_AREA_RADIUS, &x_min, &y_min, &x_max, &y_max);
+    *count = 0;
+    for (int yy = y_min; yy <= y_max; yy++) {
+        for (int xx = x_min; xx <= x_max; xx++) {
+            int building_id = map_building_at(map_grid_offset(xx, yy));
+            if (building_id && *count < SERVICE_AREA_TILES)
+                scratch[(*count)++] = building_id;
+        }
+    }
+    return scratch;
+}
 static grid_xx damage_grid = {0, {FS_UINT8, FS_UINT16}};
 static grid_xx rubble_type_grid = {0, {FS_UINT8, FS_UINT8}};
 static grid_xx highlight_grid = {0, {FS_UINT8, FS_UINT8}};
@@ -13,6 +89,8 @@ int map_building_at(int grid_offset) {
     return map_grid_is_valid_offset(grid_offset) ? map_grid_get(&buildings_grid, grid_offset) : 0;
 }
 void map_building_set(int grid_offset, int building_id) {
+    if (map_grid_get(&buildings_grid, grid_offset) != building_id)
+        invalidate_service_rows(grid_offset);
     map_grid_set(&buildings_grid, grid_offset, building_id);
 }
 void map_building_damage_clear(int grid_offset) {
@@ -47,6 +125,7 @@ void map_building_clear(void) {
     map_grid_clear(&buildings_grid);
     map_grid_clear(&damage_grid);
     map_grid_clear(&rubble_type_grid);
+    invalidate_all_service_rows();
 }
 void map_clear_highlights(void) {
     map_grid_clear(&highlight_grid);
@@ -59,6 +138,7 @@ void map_building_save_state(buffer *buildings, buffer *damage) {
 void map_building_load_state(buffer *buildings, buffer *damage) {
     map_grid_load_buffer(&buildings_grid, buildings);
     map_grid_load_buffer(&damage_grid, damage);
+    invalidate_all_service_rows();
 }
 
 int map_building_is_reservoir(int x, int y) {
@@ -4,6 +4,8 @@
 #include "building/type.h"
 #include "core/buffer.h"
 
+#include <stdint.h>
+
 /**
  * Returns the building at the given offset
  * @param grid_offset Map offset
@@ -13,6 +15,17 @@ int map_building_at(int grid_offset);
 
 void map_building_set(int grid_offset, int building_id);
 
+/**
+ * Returns the buildings within service walker range (two tiles) of the given tile:
+ * one entry per building tile, in row order, so multi-tile buildings appear once per tile.
+ * The list is cached per map row and rebuilt when buildings in range change.
+ * @param x Map x
+ * @param y Map y
+ * @param count Set to the number of entries
+ * @return Building IDs, valid until the next change to the building map
+ */
+const uint16_t *map_building_service_area(int x, int y, int *count);
+
 /**
  * Increases building damage by 1
  * @param grid_offset Map offset
@@ -3,15 +3,68 @@
 #include "building/building.h"
 #include "building/model.h"
 #include "core/calc.h"
+#include "core/game_environment.h"
+#include "core/log.h"
 #include "map/data.h"
 #include "map/grid.h"
 #include "map/property.h"
 #include "map/ring.h"
 #include "map/terrain.h"
 
+#include <string.h>
+
+// clamped values as seen by the game; this is also what gets saved
 static grid_xx desirability_grid = {0, {FS_INT8, FS_INT8}};
+// unclamped sum of all contributions, kept up to date with signed deltas
+static grid_xx desirability_sum = {0, {FS_INT32, FS_INT32}};
+// kind of terrain contribution currently applied at each tile
+static grid_xx desirability_terrain_source = {0, {FS_UINT8, FS_UINT8}};
+// tiles whose terrain changed since the last update
+static grid_xx desirability_tile_dirty = {0, {FS_UINT8, FS_UINT8}};
+// scratch grid for the debug consistency check
+static grid_xx desirability_check = {0, {FS_INT32, FS_INT32}};
+
+// terrain flags that make a tile a desirability source: plazas, fault lines, gardens and rubble
+#define SOURCE_TERRAIN (TERRAIN_ROAD | TERRAIN_ROCK | TERRAIN_GARDEN | TERRAIN_RUBBLE)
+#define MAX_DIRTY_TILES (GRID_SIZE_PH * GRID_SIZE_PH)
+
+enum {
+    TERRAIN_SOURCE_NONE = 0,
+    TERRAIN_SOURCE_PLAZA = 1,
+    TERRAIN_SOURCE_FAULT = 2,
+    TERRAIN_SOURCE_GARDEN = 3,
+    TERRAIN_SOURCE_RUBBLE = 4
+};
+
+typedef struct {
+    int x;
+    int y;
+    int size;
+    int value;
+    int step;
+    int step_size;
+    int range;
+} desirability_source;
+
+static struct {
+    desirability_source buildings[4000];
+    uint8_t building_applied[4000];
+    uint8_t building_dirty[4000];
+    int dirty_buildings[4000];
+    int num_dirty_buildings;
+    int dirty_tiles[MAX_DIRTY_TILES];
+    int num_dirty_tiles;
+    int all_tiles_dirty;
+    int rebuild_needed;
+} data = {{{0}}, {0}, {0}, {0}, 0, {0}, 0, 0, 1};
 
-static void add_desirability_at_distance(int x, int y, int size, int distance, int desirability) {
+static void add_to_tile(grid_xx *grid, int grid_offset, int desirability) {
+    int value = (int) map_grid_get(grid, grid_offset) + desirability;
+    map_grid_set(grid, grid_offset, value);
+    if (grid == &desirability_sum)
+        map_grid_set(&desirability_grid, grid_offset, calc_bound(value, -100, 100));
+}
+static void add_desirability_at_distance(grid_xx *grid, int x, int y, int size, int distance, int desirability) {
     int partially_outside_map = 0;
     if (x - distance < -1 || x + distance + size - 1 > map_data.width)
         partially_outside_map = 1;
@@ -26,99 +79,239 @@ static void add_desirability_at_distance(int x, int y, int size, int distance, i
     if (partially_outside_map) {
         for (int i = start; i < end; i++) {
             const ring_tile *tile = map_ring_tile(i);
-            if (map_ring_is_inside_map(x + tile->x, y + tile->y)) {
-                map_grid_set(&desirability_grid, base_offset + tile->grid_offset,
-                             calc_bound(
-                                     map_grid_get(&desirability_grid, base_offset + tile->grid_offset) + desirability,
-                                     -100, 100));
-            }
+            if (map_ring_is_inside_map(x + tile->x, y + tile->y))
+                add_to_tile(grid, base_offset + tile->grid_offset, desirability);
         }
     } else {
         for (int i = start; i < end; i++) {
             const ring_tile *tile = map_ring_tile(i);
-            map_grid_set(&desirability_grid, base_offset + tile->grid_offset,
-                         calc_bound(map_grid_get(&desirability_grid, base_offset + tile->grid_offset) + desirability,
-                                    -100, 100));
+            add_to_tile(grid, base_offset + tile->grid_offset, desirability);
         }
     }
 }
-static void add_to_terrain(int x, int y, int size, int desirability, int step, int step_size, int range) {
-    if (size > 0) {
-        if (range > 6) range = 6;
-        int tiles_within_step = 0;
-        int distance = 1;
-        while (range > 0) {
-            add_desirability_at_distance(x, y, size, distance, desirability);
-            distance++;
-            range--;
-            tiles_within_step++;
-            if (tiles_within_step >= step) {
-                desirability += step_size;
-                tiles_within_step = 0;
-            }
+static void add_source(grid_xx *grid, const desirability_source *src, int sign) {
+    if (src->size <= 0)
+        return;
+    int range = src->range;
+    if (range > 6) range = 6;
+    int desirability = sign * src->value;
+    int tiles_within_step = 0;
+    int distance = 1;
+    while (range > 0) {
+        add_desirability_at_distance(grid, src->x, src->y, src->size, distance, desirability);
+        distance++;
+        range--;
+        tiles_within_step++;
+        if (tiles_within_step >= src->step) {
+            desirability += sign * src->step_size;
+            tiles_within_step = 0;
         }
     }
 }
+static void model_source(desirability_source *src, int x, int y, int size, int type) {
+    const model_building *model = model_get_building(type);
+    src->x = x;
+    src->y = y;
+    src->size = size;
+    src->value = model->desirability_value;
+    src->step = model->desirability_step;
+    src->step_size = model->desirability_step_size;
+    src->range = model->desirability_range;
+}
+static int same_source(const desirability_source *a, const desirability_source *b) {
+    return a->x == b->x && a->y == b->y && a->size == b->size && a->value == b->value &&
+           a->step == b->step && a->step_size == b->step_size && a->range == b->range;
+}
 
+static int building_source(int id, desirability_source *src) {
+    building *b = building_get(id);
+    if (b->state != BUILDING_STATE_VALID)
+        return 0;
+    model_source(src, b->x, b->y, b->size, b->type);
+    return 1;
+}
+static void update_building(int id) {
+    desirability_source current;
+    int valid = building_source(id, &current);
+    desirability_source *applied = &data.buildings[id];
+    if (data.building_applied[id]) {
+        if (valid && same_source(applied, &current))
+            return;
+        add_source(&desirability_sum, applied, -1);
+        data.building_applied[id] = 0;
+    }
+    if (valid) {
+        *applied = current;
+        add_source(&desirability_sum, applied, 1);
+        data.building_applied[id] = 1;
+    }
+}
 static void update_buildings(void) {
-    int max_id = building_get_highest_id();
-    for (int i = 1; i <= max_id; i++) {
-        building *b = building_get(i);
-        if (b->state == BUILDING_STATE_VALID) {
-            const model_building *model = model_get_building(b->type);
-            add_to_terrain(
-                    b->x, b->y, b->size,
-                    model->desirability_value,
-                    model->desirability_step,
-                    model->desirability_step_size,
-                    model->desirability_range);
+    for (int i = 0; i < data.num_dirty_buildings; i++) {
+        int id = data.dirty_buildings[i];
+        update_building(id);
+        data.building_dirty[id] = 0;
+    }
+    data.num_dirty_buildings = 0;
+}
+
+static int terrain_source_at(int grid_offset) {
+    int terrain = map_terrain_get(grid_offset);
+    if (map_property_is_plaza_or_earthquake(grid_offset)) {
+        if (terrain & TERRAIN_ROAD)
+            return TERRAIN_SOURCE_PLAZA;
+        else if (terrain & TERRAIN_ROCK) {
+            // earthquake fault line: slight negative
+            return TERRAIN_SOURCE_FAULT;
+        } else {
+            // invalid plaza/earthquake flag
+            map_property_clear_plaza_or_earthquake(grid_offset);
+            return TERRAIN_SOURCE_NONE;
         }
+    } else if (terrain & TERRAIN_GARDEN)
+        return TERRAIN_SOURCE_GARDEN;
+    else if (terrain & TERRAIN_RUBBLE)
+        return TERRAIN_SOURCE_RUBBLE;
+    return TERRAIN_SOURCE_NONE;
+}
+static void add_terrain_source(grid_xx *grid, int x, int y, int kind, int sign) {
+    desirability_source src;
+    switch (kind) {
+        case TERRAIN_SOURCE_PLAZA:
+            model_source(&src, x, y, 1, BUILDING_PLAZA);
+            break;
+        case TERRAIN_SOURCE_FAULT:
+            model_source(&src, x, y, 1, BUILDING_HOUSE_VACANT_LOT);
+            break;
+        case TERRAIN_SOURCE_GARDEN:
+            model_source(&src, x, y, 1, BUILDING_GARDENS);
+            break;
+        case TERRAIN_SOURCE_RUBBLE:
+            src = {x, y, 1, -2, 1, 1, 2};
+            break;
+        default:
+            return;
     }
+    add_source(grid, &src, sign);
+}
+static void update_tile(int grid_offset) {
+    int x = map_grid_offset_to_x(grid_offset);
+    int y = map_grid_offset_to_y(grid_offset);
+    if (!map_grid_is_inside(x, y, 1))
+        return;
+    int kind = terrain_source_at(grid_offset);
+    int applied = (int) map_grid_get(&desirability_terrain_source, grid_offset);
+    if (kind == applied)
+        return;
+    add_terrain_source(&desirability_sum, x, y, applied, -1);
+    add_terrain_source(&desirability_sum, x, y, kind, 1);
+    map_grid_set(&desirability_terrain_source, grid_offset, kind);
 }
 static void update_terrain(void) {
+    // clearing an invalid plaza flag queues the tile again: like the full scan did, its garden or
+    // rubble only counts from the next update on
+    if (data.all_tiles_dirty) {
+        map_grid_clear(&desirability_tile_dirty);
+        data.num_dirty_tiles = 0;
+        data.all_tiles_dirty = 0;
+        int grid_offset = map_data.start_offset;
+        for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
+            for (int x = 0; x < map_data.width; x++, grid_offset++)
+                update_tile(grid_offset);
+        }
+        return;
+    }
+    int count = data.num_dirty_tiles;
+    for (int i = 0; i < count; i++) {
+        map_grid_set(&desirability_tile_dirty, data.dirty_tiles[i], 0);
+        update_tile(data.dirty_tiles[i]);
+    }
+    data.num_dirty_tiles -= count;
+    memmove(data.dirty_tiles, data.dirty_tiles + count, data.num_dirty_tiles * sizeof(int));
+}
+
+static void reset_contributions(void) {
+    map_grid_clear(&desirability_sum);
+    map_grid_clear(&desirability_terrain_source);
+    map_grid_clear(&desirability_tile_dirty);
+    memset(data.building_applied, 0, sizeof(data.building_applied));
+    memset(data.building_dirty, 0, sizeof(data.building_dirty));
+    data.num_dirty_buildings = 0;
+    data.num_dirty_tiles = 0;
+    data.all_tiles_dirty = 0;
+}
+static void rebuild(void) {
+    reset_contributions();
+    int max_id = building_get_highest_id();
+    for (int i = 1; i <= max_id && i < MAX_BUILDINGS[1]; i++)
+        update_building(i);
+    data.all_tiles_dirty = 1;
+    update_terrain();
+    data.rebuild_needed = 0;
+}
+static void check_consistency(void) {
+    map_grid_clear(&desirability_check);
+    int max_id = building_get_highest_id();
+    for (int i = 1; i <= max_id; i++) {
+        desirability_source src;
+        if (building_source(i, &src))
+            add_source(&desirability_check, &src, 1);
+    }
     int grid_offset = map_data.start_offset;
     for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
         for (int x = 0; x < map_data.width; x++, grid_offset++) {
-            int terrain = map_terrain_get(grid_offset);
-            if (map_property_is_plaza_or_earthquake(grid_offset)) {
-                int type;
-                if (terrain & TERRAIN_ROAD)
-                    type = BUILDING_PLAZA;
-                else if (terrain & TERRAIN_ROCK) {
-                    // earthquake fault line: slight negative
-                    type = BUILDING_HOUSE_VACANT_LOT;
-                } else {
-                    // invalid plaza/earthquake flag
-                    map_property_clear_plaza_or_earthquake(grid_offset);
-                    continue;
-                }
-                const model_building *model = model_get_building(type);
-                add_to_terrain(x, y, 1,
-                               model->desirability_value,
-                               model->desirability_step,
-                               model->desirability_step_size,
-                               model->desirability_range);
-            } else if (terrain & TERRAIN_GARDEN) {
-                const model_building *model = model_get_building(BUILDING_GARDENS);
-                add_to_terrain(x, y, 1,
-                               model->desirability_value,
-                               model->desirability_step,
-                               model->desirability_step_size,
-                               model->desirability_range);
-            } else if (terrain & TERRAIN_RUBBLE)
-                add_to_terrain(x, y, 1, -2, 1, 1, 2);
-
+            // tiles queued during the update only change on the next one
+            int kind = map_grid_get(&desirability_tile_dirty, grid_offset)
+                       ? (int) map_grid_get(&desirability_terrain_source, grid_offset)
+                       : terrain_source_at(grid_offset);
+            add_terrain_source(&desirability_check, x, y, kind, 1);
         }
     }
+    int mismatches = 0;
+    for (int i = 0; i < desirability_sum.size_total / desirability_sum.size_field; i++) {
+        if (map_grid_get(&desirability_sum, i) != map_grid_get(&desirability_check, i))
+            mismatches++;
+    }
+    if (mismatches) {
+        log_error("Desirability out of sync, tiles:", 0, mismatches);
+        data.rebuild_needed = 1;
+    }
 }
 
 void map_desirability_clear(void) {
     map_grid_clear(&desirability_grid);
+    reset_contributions();
+    // buildings and terrain of the new map are added as a whole on the first update
+    data.rebuild_needed = 1;
 }
 void map_desirability_update(void) {
-    map_desirability_clear();
-    update_buildings();
-    update_terrain();
+    if (data.rebuild_needed) {
+        map_grid_clear(&desirability_grid);
+        rebuild();
+    } else {
+        update_buildings();
+        update_terrain();
+    }
+    if (is_debug_mode())
+        check_consistency();
+}
+void map_desirability_building_changed(int building_id) {
+    if (building_id <= 0 || building_id >= MAX_BUILDINGS[1] || data.building_dirty[building_id])
+        return;
+    data.building_dirty[building_id] = 1;
+    data.dirty_buildings[data.num_dirty_buildings++] = building_id;
+}
+void map_desirability_tile_changed(int grid_offset, int terrain) {
+    if (!(terrain & SOURCE_TERRAIN) || data.all_tiles_dirty || grid_offset < 0 || grid_offset >= MAX_DIRTY_TILES)
+        return;
+    if (map_grid_get(&desirability_tile_dirty, grid_offset))
+        return;
+    map_grid_set(&desirability_tile_dirty, grid_offset, 1);
+    data.dirty_tiles[data.num_dirty_tiles++] = grid_offset;
+}
+void map_desirability_all_tiles_changed(int terrain) {
+    if (terrain & SOURCE_TERRAIN)
+        data.all_tiles_dirty = 1;
 }
 int map_desirability_get(int grid_offset) {
     return map_grid_get(&desirability_grid, grid_offset);
@@ -144,4 +337,6 @@ void map_desirability_save_state(buffer *buf) {
 }
 void map_desirability_load_state(buffer *buf) {
     map_grid_load_buffer(&desirability_grid, buf);
+    // the saved grid is clamped, so the contributions are rebuilt on the next update
+    data.rebuild_needed = 1;
 }
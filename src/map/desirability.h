@@ -7,6 +7,24 @@ void map_desirability_clear(void);
 
 void map_desirability_update(void);
 
+/**
+ * Queues a building whose state, type, size or position changed; its contribution is
+ * updated on the next daily update
+ */
+void map_desirability_building_changed(int building_id);
+
+/**
+ * Queues a tile whose terrain or plaza flag changed
+ * @param terrain Terrain flags that changed, flags that don't affect desirability are ignored
+ */
+void map_desirability_tile_changed(int grid_offset, int terrain);
+
+/**
+ * Queues every tile, after terrain was changed as a whole
+ * @param terrain Terrain flags that changed
+ */
+void map_desirability_all_tiles_changed(int terrain);
+
 int map_desirability_get(int grid_offset);
 
 int map_desirability_get_max(int x, int y, int size);
@@ -1,9 +1,106 @@
 #include "figure.h"
 
+#include "core/calc.h"
+#include "core/game_environment.h"
 #include "map/grid.h"
 
+#include <string.h>
+
 static grid_xx figures = {0, {FS_UINT16, FS_UINT16}};
 
+#define INDEX_CELL_SHIFT 3
+#define INDEX_CELLS_PER_SIDE 32
+#define INDEX_NUM_CELLS (INDEX_CELLS_PER_SIDE * INDEX_CELLS_PER_SIDE)
+#define INDEX_MAX_FIGURES 5000
+
+// coarse spatial index of figures: per class, each cell of 8x8 tiles holds a doubly linked list
+static struct {
+    int needs_rebuild;
+    short head[FIGURE_INDEX_NUM_CLASSES][INDEX_NUM_CELLS];
+    short next[INDEX_MAX_FIGURES];
+    short prev[INDEX_MAX_FIGURES];
+    short cell[INDEX_MAX_FIGURES];
+    unsigned char figure_class[INDEX_MAX_FIGURES];
+} index_data = {1};
+
+static int index_class_for(figure *f) {
+    if (f->is_enemy())
+        return FIGURE_INDEX_ENEMY;
+    else if (f->is_legion())
+        return FIGURE_INDEX_SOLDIER;
+    else if (f->is_herd())
+        return FIGURE_INDEX_ANIMAL;
+    else
+        return FIGURE_INDEX_CITIZEN;
+}
+static int index_cell_coord(int tile) {
+    int cell = tile >> INDEX_CELL_SHIFT;
+    return calc_bound(cell, 0, INDEX_CELLS_PER_SIDE - 1);
+}
+static void index_remove(int id) {
+    if (id <= 0 || id >= INDEX_MAX_FIGURES || index_data.cell[id] < 0)
+        return;
+    int cls = index_data.figure_class[id];
+    int cell = index_data.cell[id];
+    if (index_data.prev[id])
+        index_data.next[index_data.prev[id]] = index_data.next[id];
+    else
+        index_data.head[cls][cell] = index_data.next[id];
+    if (index_data.next[id])
+        index_data.prev[index_data.next[id]] = index_data.prev[id];
+    index_data.next[id] = index_data.prev[id] = 0;
+    index_data.cell[id] = -1;
+}
+static void index_add(figure *f) {
+    int id = f->id;
+    if (id <= 0 || id >= INDEX_MAX_FIGURES)
+        return;
+    index_remove(id);
+    int cls = index_class_for(f);
+    int cell = index_cell_coord(f->tile_y) * INDEX_CELLS_PER_SIDE + index_cell_coord(f->tile_x);
+    index_data.figure_class[id] = cls;
+    index_data.cell[id] = cell;
+    index_data.prev[id] = 0;
+    index_data.next[id] = index_data.head[cls][cell];
+    if (index_data.head[cls][cell])
+        index_data.prev[index_data.head[cls][cell]] = id;
+    index_data.head[cls][cell] = id;
+}
+static void index_rebuild(void) {
+    memset(index_data.head, 0, sizeof(index_data.head));
+    memset(index_data.cell, -1, sizeof(index_data.cell));
+    index_data.needs_rebuild = 0;
+    for (int i = 1; i < MAX_FIGURES[get_game_engine()]; i++) {
+        figure *f = figure_get(i);
+        if (f->state && map_grid_is_valid_offset(f->grid_offset_figure))
+            index_add(f);
+    }
+}
+void map_figure_foreach_in_radius(int x, int y, int radius, int classes,
+                                  void (*callback)(figure *f, void *user_data), void *user_data) {
+    if (index_data.needs_rebuild)
+        index_rebuild();
+    // one tile of slack for figures whose tile changed since they were indexed
+    int cell_x_min = index_cell_coord(x - radius - 1);
+    int cell_x_max = index_cell_coord(x + radius + 1);
+    int cell_y_min = index_cell_coord(y - radius - 1);
+    int cell_y_max = index_cell_coord(y + radius + 1);
+    for (int cls = 0; cls < FIGURE_INDEX_NUM_CLASSES; cls++) {
+        if (!(classes & (1 << cls)))
+            continue;
+        for (int cy = cell_y_min; cy <= cell_y_max; cy++) {
+            for (int cx = cell_x_min; cx <= cell_x_max; cx++) {
+                int id = index_data.head[cls][cy * INDEX_CELLS_PER_SIDE + cx];
+                while (id) {
+                    int next = index_data.next[id];
+                    callback(figure_get(id), user_data);
+                    id = next;
+                }
+            }
+        }
+    }
+}
+
 int map_has_figure_at(int grid_offset) {
     return map_grid_is_valid_offset(grid_offset) && map_grid_get(&figures, grid_offset) > 0;
 }
@@ -58,6 +155,8 @@ int map_figure_foreach_until(int grid_offset, int test) {
 void figure::map_figure_add() {
     if (!map_grid_is_valid_offset(grid_offset_figure))
         return;
+    if (!index_data.needs_rebuild)
+        index_add(this);
 
     // check for figures on new tile, update "next_figure" pointers accordingly
     next_figure = 0;
@@ -93,6 +192,8 @@ void figure::map_figure_update() { // useless - but used temporarily for checkin
     }
 }
 void figure::map_figure_remove() {
+    if (!index_data.needs_rebuild)
+        index_remove(id);
     if (!map_grid_is_valid_offset(grid_offset_figure) || !map_grid_get(&figures, grid_offset_figure)) {
         next_figure = 0;
         return;
@@ -112,6 +213,7 @@ void figure::map_figure_remove() {
 }
 void map_figure_clear(void) {
     map_grid_clear(&figures);
+    index_data.needs_rebuild = 1;
 }
 
 void map_figure_save_state(buffer *buf) {
@@ -119,4 +221,5 @@ void map_figure_save_state(buffer *buf) {
 }
 void map_figure_load_state(buffer *buf) {
     map_grid_load_buffer(&figures, buf);
+    index_data.needs_rebuild = 1;
 }
@@ -40,6 +40,32 @@ int map_has_figure_at(int grid_offset);
 
 int map_figure_foreach_until(int grid_offset, int test);
 
+enum {
+    FIGURE_INDEX_ENEMY = 0,
+    FIGURE_INDEX_CITIZEN = 1,
+    FIGURE_INDEX_SOLDIER = 2,
+    FIGURE_INDEX_ANIMAL = 3,
+    FIGURE_INDEX_NUM_CLASSES = 4
+};
+
+#define FIGURE_INDEX_MASK(c) (1 << (c))
+#define FIGURE_INDEX_MASK_ALL ((1 << FIGURE_INDEX_NUM_CLASSES) - 1)
+
+/**
+ * Calls the callback for every figure on the map of the given classes that may be within
+ * radius tiles of (x, y). The order is unspecified, and figures slightly outside the radius
+ * may be included, so callers must check the distance and break ties themselves.
+ * Citizens include every figure that is not an enemy, soldier or herd animal.
+ * @param x Center x
+ * @param y Center y
+ * @param radius Maximum distance (chessboard metric)
+ * @param classes Bitmask of FIGURE_INDEX_MASK() values
+ * @param callback Function to call
+ * @param user_data Passed to the callback
+ */
+void map_figure_foreach_in_radius(int x, int y, int radius, int classes,
+                                  void (*callback)(figure *f, void *user_data), void *user_data);
+
 /**
  * Clears the map
  */
@@ -327,31 +327,40 @@ void map_grid_and_all(grid_xx *grid, int mask) {
     }
 }
 
+template <typename T>
+static void save_items(grid_xx *grid, buffer *buf) {
+    buf->write_array((const T *) grid->items_xx, grid_total_size[get_game_engine()]);
+}
+template <typename T>
+static void load_items(grid_xx *grid, buffer *buf) {
+    size_t total = grid_total_size[get_game_engine()];
+    size_t loaded = buf->read_array((T *) grid->items_xx, total);
+    // missing data reads as zero, same as the scalar buffer readers
+    if (loaded < total)
+        memset((T *) grid->items_xx + loaded, 0, (total - loaded) * sizeof(T));
+}
+
 void map_grid_save_buffer(grid_xx *grid, buffer *buf) {
     if (!grid->initialized)
         map_grid_init(grid);
     switch (grid->datatype[get_game_engine()]) {
         case FS_UINT8:
-            buf->write_raw(grid->items_xx, grid_total_size[get_game_engine()]);
+            save_items<uint8_t>(grid, buf);
             break;
         case FS_INT8:
-            buf->write_raw(grid->items_xx, grid_total_size[get_game_engine()]);
+            save_items<int8_t>(grid, buf);
             break;
         case FS_UINT16:
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                buf->write_u16(((uint16_t *) grid->items_xx)[i]);
+            save_items<uint16_t>(grid, buf);
             break;
         case FS_INT16:
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                buf->write_i16(((int16_t *) grid->items_xx)[i]);
+            save_items<int16_t>(grid, buf);
             break;
         case FS_UINT32:
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                buf->write_u32(((uint32_t *) grid->items_xx)[i]);
+            save_items<uint32_t>(grid, buf);
             break;
         case FS_INT32:
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                buf->write_i32(((int32_t *) grid->items_xx)[i]);
+            save_items<int32_t>(grid, buf);
             break;
     }
 }
@@ -360,37 +369,24 @@ void map_grid_load_buffer(grid_xx *grid, buffer *buf) {
         map_grid_init(grid);
     switch (grid->datatype[get_game_engine()]) {
         case FS_UINT8:
-            buf->read_raw(grid->items_xx, grid_total_size[get_game_engine()]);
+            load_items<uint8_t>(grid, buf);
             break;
         case FS_INT8:
-            buf->read_raw(grid->items_xx, grid_total_size[get_game_engine()]);
+            load_items<int8_t>(grid, buf);
             break;
-        case FS_UINT16: {
-            uint16_t *dr_data = (uint16_t *) grid->items_xx;
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                dr_data[i] = buf->read_u16();
+        case FS_UINT16:
+            load_items<uint16_t>(grid, buf);
             break;
-        }
-        case FS_INT16: {
-            int16_t *dr_data = (int16_t *) grid->items_xx;
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                dr_data[i] = buf->read_i16();
+        case FS_INT16:
+            load_items<int16_t>(grid, buf);
             break;
-        }
-        case FS_UINT32: {
-            uint32_t *dr_data = (uint32_t *) grid->items_xx;
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                dr_data[i] = buf->read_u32();
+        case FS_UINT32:
+            load_items<uint32_t>(grid, buf);
             break;
-        }
-        case FS_INT32: {
-            int32_t *dr_data = (int32_t *) grid->items_xx;
-            for (int i = 0; i < grid_total_size[get_game_engine()]; i++)
-                dr_data[i] = buf->read_i32();
+        case FS_INT32:
+            load_items<int32_t>(grid, buf);
             break;
-        }
     }
-    return;
 }
 
 void map_grid_data_init(int width, int height, int start_offset, int border_size) {
@@ -10,6 +10,8 @@
 #include "map/building.h"
 #include "map/building_tiles.h"
 #include "map/data.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/grid.h"
 #include "map/image.h"
 #include "map/property.h"
@@ -119,6 +121,8 @@ void map_natives_init(void) {
             building *b = building_create(type, x, y);
             map_building_set(grid_offset, b->id);
             b->state = BUILDING_STATE_VALID;
+            map_desirability_building_changed(b->id);
+            map_water_supply_building_changed(b->id);
             switch (type) {
                 case BUILDING_NATIVE_CROPS:
                     b->data.industry.progress = random_bit;
@@ -180,6 +184,8 @@ void map_natives_init_editor(void) {
             }
             building *b = building_create(type, x, y);
             b->state = BUILDING_STATE_VALID;
+            map_desirability_building_changed(b->id);
+            map_water_supply_building_changed(b->id);
             map_building_set(grid_offset, b->id);
             if (type == BUILDING_NATIVE_MEETING) {
                 map_building_set(grid_offset + map_grid_delta(1, 0), b->id);
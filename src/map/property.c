@@ -1,7 +1,9 @@
 #include "property.h"
 
+#include "map/desirability.h"
 #include "map/grid.h"
 #include "map/random.h"
+#include "map/terrain.h"
 
 enum {
     BIT_SIZE1 = 0x00,
@@ -152,9 +154,11 @@ int map_property_is_plaza_or_earthquake(int grid_offset) {
 
 void map_property_mark_plaza_or_earthquake(int grid_offset) {
     map_grid_or(&bitfields_grid, grid_offset, BIT_PLAZA_OR_EARTHQUAKE);
+    map_desirability_tile_changed(grid_offset, TERRAIN_ALL);
 }
 void map_property_clear_plaza_or_earthquake(int grid_offset) {
     map_grid_and(&bitfields_grid, grid_offset, BIT_NO_PLAZA);
+    map_desirability_tile_changed(grid_offset, TERRAIN_ALL);
 }
 
 int map_property_is_constructing(int grid_offset) {
@@ -191,6 +195,7 @@ void map_property_backup(void) {
 void map_property_restore(void) {
     map_grid_copy(&bitfields_backup, &bitfields_grid);
     map_grid_copy(&edge_backup, &edge_grid);
+    map_desirability_all_tiles_changed(TERRAIN_ALL);
 }
 void map_property_save_state(buffer *bitfields, buffer *edge) {
     map_grid_save_buffer(&bitfields_grid, bitfields);
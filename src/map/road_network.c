@@ -8,18 +8,48 @@
 
 #include <string.h>
 
-#define MAX_QUEUE 1000
+#define MAX_TILES (GRID_SIZE_PH * GRID_SIZE_PH)
+#define MAX_NETWORKS 256
 
 static const int ADJACENT_OFFSETS_C3[] = {-GRID_SIZE_C3, 1, GRID_SIZE_C3, -1};
 static const int ADJACENT_OFFSETS_PH[] = {-GRID_SIZE_PH, 1, GRID_SIZE_PH, -1};
 
 static grid_xx network = {0, {FS_UINT8, FS_UINT8}};
 
+enum {
+    TILE_NONE = 0,
+    TILE_CONNECTOR = 1,
+    TILE_ROAD = 2
+};
+
+// Networks are kept up to date as road tiles change: added tiles join their neighbours
+// (the smaller network is relabeled into the larger one), removed tiles mark their
+// network as possibly split, and only those networks are flooded again on update.
+// Internal ids are reused freely; the ids handed out are numbered by the first road tile
+// of each network in map order, like a full flood from the road tiles would number them.
 static struct {
-    int items[MAX_QUEUE];
-    int head;
-    int tail;
-} queue;
+    int needs_rebuild;
+    int overflow;
+    int networks_changed;
+    struct {
+        int in_use;
+        int size;
+        int roads;
+        int first_road;
+        int head;
+        int tail;
+        int maybe_split;
+    } networks[MAX_NETWORKS];
+    uint8_t public_id[MAX_NETWORKS];
+    int member_next[MAX_TILES];
+    int member_prev[MAX_TILES];
+    uint8_t tile_type[MAX_TILES];
+    uint8_t is_road[MAX_TILES];
+    uint8_t is_pending[MAX_TILES];
+    int pending[MAX_TILES];
+    int num_pending;
+    int queue[MAX_TILES];
+} data = {1};
 
 int adjacent_offsets(int i) {
     switch (get_game_engine()) {
@@ -32,65 +62,250 @@ int adjacent_offsets(int i) {
 
 void map_road_network_clear(void) {
     map_grid_clear(&network);
+    data.needs_rebuild = 1;
 }
 int map_road_network_get(int grid_offset) {
-    return map_grid_get(&network, grid_offset);
+    // networks without a road tile (e.g. a lone warehouse) have no public id
+    return data.public_id[map_grid_get(&network, grid_offset)];
 }
 
-static int mark_road_network(int grid_offset, uint8_t network_id) {
-    memset(&queue, 0, sizeof(queue));
-    int guard = 0;
-    int next_offset;
-    int size = 1;
-    do {
-        if (++guard >= grid_total_size[get_game_engine()])
-            break;
-
-        map_grid_set(&network, grid_offset, network_id);
-        next_offset = -1;
-        for (int i = 0; i < 4; i++) {
-            int new_offset = grid_offset + adjacent_offsets(i);
-            if (map_routing_citizen_is_passable(new_offset) && !map_grid_get(&network, new_offset)) {
-                if (map_routing_citizen_is_road(new_offset) || map_terrain_is(new_offset, TERRAIN_ACCESS_RAMP)) {
-                    map_grid_set(&network, new_offset, network_id);
-                    size++;
-                    if (next_offset == -1)
-                        next_offset = new_offset;
-                    else {
-                        queue.items[queue.tail++] = new_offset;
-                        if (queue.tail >= MAX_QUEUE)
-                            queue.tail = 0;
+static int is_network_tile(int grid_offset) {
+    if (map_routing_citizen_is_road(grid_offset))
+        return 1;
+    return map_routing_citizen_is_passable(grid_offset) && map_terrain_is(grid_offset, TERRAIN_ACCESS_RAMP);
+}
+static int get_tile_type(int grid_offset) {
+    if (!is_network_tile(grid_offset))
+        return TILE_NONE;
+    return map_terrain_is(grid_offset, TERRAIN_ROAD) ? TILE_ROAD : TILE_CONNECTOR;
+}
 
-                    }
-                }
-            }
+void map_road_network_tile_changed(int grid_offset) {
+    if (data.needs_rebuild || grid_offset < 0 || grid_offset >= grid_total_size[get_game_engine()])
+        return;
+    int type = get_tile_type(grid_offset);
+    if (type == data.tile_type[grid_offset])
+        return;
+    data.tile_type[grid_offset] = type;
+    if (data.is_pending[grid_offset])
+        return;
+    data.is_pending[grid_offset] = 1;
+    data.pending[data.num_pending++] = grid_offset;
+}
+static int allocate_network(void) {
+    for (int i = 1; i < MAX_NETWORKS; i++) {
+        if (!data.networks[i].in_use) {
+            memset(&data.networks[i], 0, sizeof(data.networks[i]));
+            data.networks[i].in_use = 1;
+            return i;
         }
-        if (next_offset == -1) {
-            if (queue.head == queue.tail)
-                return size;
-
-            next_offset = queue.items[queue.head++];
-            if (queue.head >= MAX_QUEUE)
-                queue.head = 0;
+    }
+    data.overflow = 1;
+    return 0;
+}
+static void add_member(int network_id, int grid_offset) {
+    map_grid_set(&network, grid_offset, network_id);
+    data.is_road[grid_offset] = map_terrain_is(grid_offset, TERRAIN_ROAD) ? 1 : 0;
+    if (!network_id)
+        return;
+    data.member_next[grid_offset] = 0;
+    data.member_prev[grid_offset] = data.networks[network_id].tail;
+    if (data.networks[network_id].tail)
+        data.member_next[data.networks[network_id].tail] = grid_offset;
+    else {
+        data.networks[network_id].head = grid_offset;
+    }
+    data.networks[network_id].tail = grid_offset;
+    data.networks[network_id].size++;
+    data.networks[network_id].roads += data.is_road[grid_offset];
+    if (data.is_road[grid_offset] &&
+        (!data.networks[network_id].first_road || grid_offset < data.networks[network_id].first_road))
+        data.networks[network_id].first_road = grid_offset;
+}
+static void remove_member(int grid_offset) {
+    int network_id = map_grid_get(&network, grid_offset);
+    map_grid_set(&network, grid_offset, 0);
+    if (!network_id)
+        return;
+    int prev = data.member_prev[grid_offset];
+    int next = data.member_next[grid_offset];
+    if (prev)
+        data.member_next[prev] = next;
+    else {
+        data.networks[network_id].head = next;
+    }
+    if (next)
+        data.member_prev[next] = prev;
+    else {
+        data.networks[network_id].tail = prev;
+    }
+    data.networks[network_id].size--;
+    data.networks[network_id].roads -= data.is_road[grid_offset];
+    if (!data.networks[network_id].size)
+        data.networks[network_id].in_use = 0;
+}
+static void merge_networks(int into, int from) {
+    for (int offset = data.networks[from].head; offset; offset = data.member_next[offset])
+        map_grid_set(&network, offset, into);
 
+    data.member_prev[data.networks[from].head] = data.networks[into].tail;
+    data.member_next[data.networks[into].tail] = data.networks[from].head;
+    data.networks[into].tail = data.networks[from].tail;
+    data.networks[into].size += data.networks[from].size;
+    data.networks[into].roads += data.networks[from].roads;
+    if (data.networks[from].first_road &&
+        (!data.networks[into].first_road || data.networks[from].first_road < data.networks[into].first_road))
+        data.networks[into].first_road = data.networks[from].first_road;
+    data.networks[into].maybe_split |= data.networks[from].maybe_split;
+    data.networks[from].in_use = 0;
+    data.networks[from].size = 0;
+    data.networks[from].roads = 0;
+}
+static int is_labeled(int grid_offset) {
+    // networks that did not get an id are tracked through the is_pending flag while rebuilding
+    return map_grid_get(&network, grid_offset) || data.is_pending[grid_offset];
+}
+static void mark_road_network(int grid_offset, int network_id) {
+    int head = 0;
+    int tail = 0;
+    add_member(network_id, grid_offset);
+    data.is_pending[grid_offset] = !network_id;
+    data.queue[tail++] = grid_offset;
+    while (head < tail) {
+        int offset = data.queue[head++];
+        for (int i = 0; i < 4; i++) {
+            int new_offset = offset + adjacent_offsets(i);
+            if (!map_grid_is_valid_offset(new_offset) || is_labeled(new_offset))
+                continue;
+            if (is_network_tile(new_offset)) {
+                add_member(network_id, new_offset);
+                data.is_pending[new_offset] = !network_id;
+                data.queue[tail++] = new_offset;
+            }
         }
-        grid_offset = next_offset;
-    } while (next_offset > -1);
-    return size;
+    }
 }
-
-void map_road_network_update(void) {
-    city_map_clear_largest_road_networks();
+static void rebuild_all(void) {
     map_grid_clear(&network);
-    int network_id = 1;
+    memset(data.networks, 0, sizeof(data.networks));
+    memset(data.is_pending, 0, sizeof(data.is_pending));
+    data.num_pending = 0;
+    data.overflow = 0;
     int grid_offset = map_data.start_offset;
     for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
         for (int x = 0; x < map_data.width; x++, grid_offset++) {
-            if (map_terrain_is(grid_offset, TERRAIN_ROAD) && !map_grid_get(&network, grid_offset)) {
-                int size = mark_road_network(grid_offset, network_id);
-                city_map_add_to_largest_road_networks(network_id, size);
-                network_id++;
+            data.tile_type[grid_offset] = get_tile_type(grid_offset);
+            if (!is_labeled(grid_offset) && data.tile_type[grid_offset] != TILE_NONE)
+                mark_road_network(grid_offset, allocate_network());
+        }
+    }
+    memset(data.is_pending, 0, sizeof(data.is_pending));
+    data.needs_rebuild = data.overflow;
+}
+static void apply_pending_changes(void) {
+    // removals first, so that additions never join a network through a tile that is gone
+    for (int i = 0; i < data.num_pending; i++) {
+        int grid_offset = data.pending[i];
+        int network_id = map_grid_get(&network, grid_offset);
+        if (!network_id)
+            continue;
+        if (is_network_tile(grid_offset)) {
+            int is_road = map_terrain_is(grid_offset, TERRAIN_ROAD) ? 1 : 0;
+            data.networks[network_id].roads += is_road - data.is_road[grid_offset];
+            data.is_road[grid_offset] = is_road;
+            int first_road = data.networks[network_id].first_road;
+            if (is_road && (!first_road || grid_offset < first_road))
+                data.networks[network_id].first_road = grid_offset;
+            else if (!is_road && grid_offset == first_road)
+                data.networks[network_id].maybe_split = 1; // flooded again to find the next first road
+        } else {
+            remove_member(grid_offset);
+            data.networks[network_id].maybe_split = 1;
+        }
+    }
+    for (int i = 0; i < data.num_pending; i++) {
+        int grid_offset = data.pending[i];
+        data.is_pending[grid_offset] = 0;
+        if (map_grid_get(&network, grid_offset) || !is_network_tile(grid_offset))
+            continue;
+        int network_id = allocate_network();
+        if (!network_id)
+            return;
+        add_member(network_id, grid_offset);
+        for (int d = 0; d < 4; d++) {
+            int other = map_grid_get(&network, grid_offset + adjacent_offsets(d));
+            if (!other || other == network_id)
+                continue;
+            if (data.networks[other].size > data.networks[network_id].size) {
+                merge_networks(other, network_id);
+                network_id = other;
+            } else {
+                merge_networks(network_id, other);
             }
         }
     }
+    data.num_pending = 0;
+}
+static void split_networks(void) {
+    for (int n = 1; n < MAX_NETWORKS; n++) {
+        if (!data.networks[n].in_use || !data.networks[n].maybe_split)
+            continue;
+        // collect the members in a scratch list past the pending entries, then flood them again
+        int count = 0;
+        for (int offset = data.networks[n].head; offset; offset = data.member_next[offset]) {
+            data.pending[count++] = offset;
+            map_grid_set(&network, offset, 0);
+        }
+        memset(&data.networks[n], 0, sizeof(data.networks[n]));
+        data.networks[n].in_use = 1;
+        int network_id = n;
+        for (int i = 0; i < count; i++) {
+            if (map_grid_get(&network, data.pending[i]))
+                continue;
+            if (!network_id)
+                network_id = allocate_network();
+            if (!network_id)
+                return;
+            mark_road_network(data.pending[i], network_id);
+            network_id = 0;
+        }
+    }
+}
+static void number_networks(void) {
+    int order[MAX_NETWORKS];
+    int count = 0;
+    memset(data.public_id, 0, sizeof(data.public_id));
+    for (int n = 1; n < MAX_NETWORKS; n++) {
+        if (!data.networks[n].in_use || !data.networks[n].roads)
+            continue;
+        int i = count++;
+        while (i > 0 && data.networks[order[i - 1]].first_road > data.networks[n].first_road) {
+            order[i] = order[i - 1];
+            i--;
+        }
+        order[i] = n;
+    }
+    city_map_clear_largest_road_networks();
+    for (int i = 0; i < count; i++) {
+        data.public_id[order[i]] = i + 1;
+        city_map_add_to_largest_road_networks(i + 1, data.networks[order[i]].size);
+    }
+}
+
+void map_road_network_update(void) {
+    if (!data.needs_rebuild && data.num_pending) {
+        apply_pending_changes();
+        split_networks();
+        data.networks_changed = 1;
+        if (data.overflow)
+            data.needs_rebuild = 1;
+    }
+    if (data.needs_rebuild) {
+        rebuild_all();
+        data.networks_changed = 1;
+    }
+    if (!data.networks_changed)
+        return;
+    number_networks();
+    data.networks_changed = 0;
 }
@@ -5,6 +5,13 @@ void map_road_network_clear(void);
 
 int map_road_network_get(int grid_offset);
 
+/**
+ * Checks whether a tile became or stopped being part of a road network after the citizen
+ * routing was rebuilt, and if so marks it for the next call to map_road_network_update()
+ * @param grid_offset Map offset
+ */
+void map_road_network_tile_changed(int grid_offset);
+
 void map_road_network_update(void);
 
 #endif // MAP_ROAD_NETWORK_H
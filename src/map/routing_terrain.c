@@ -9,6 +9,7 @@
 #include "map/image.h"
 #include "map/property.h"
 #include "map/random.h"
+#include "map/road_network.h"
 #include "map/routing_data.h"
 #include "map/sprite.h"
 #include "map/terrain.h"
@@ -225,6 +226,12 @@ void map_routing_update_land_citizen(void) {
             }
         }
     }
+    grid_offset = map_data.start_offset;
+    for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
+        for (int x = 0; x < map_data.width; x++, grid_offset++) {
+            map_road_network_tile_changed(grid_offset);
+        }
+    }
 }
 void map_routing_update_water(void) {
     map_grid_fill(&terrain_water, -1);
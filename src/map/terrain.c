@@ -1,5 +1,6 @@
 #include "terrain.h"
 
+#include "map/desirability.h"
 #include "map/grid.h"
 #include "map/ring.h"
 #include "map/routing.h"
@@ -36,13 +37,19 @@ int map_terrain_get(int grid_offset) {
     return map_grid_get(&terrain_grid, grid_offset);
 }
 void map_terrain_set(int grid_offset, int terrain) {
+    // the fountain range is owned by the water supply, which only updates it when its coverage changes
+    int current = (int) map_grid_get(&terrain_grid, grid_offset);
+    terrain = (terrain & ~TERRAIN_FOUNTAIN_RANGE) | (current & TERRAIN_FOUNTAIN_RANGE);
+    map_desirability_tile_changed(grid_offset, current ^ terrain);
     map_grid_set(&terrain_grid, grid_offset, terrain);
 }
 void map_terrain_add(int grid_offset, int terrain) {
     map_grid_or(&terrain_grid, grid_offset, terrain);
+    map_desirability_tile_changed(grid_offset, terrain);
 }
 void map_terrain_remove(int grid_offset, int terrain) {
     map_grid_and(&terrain_grid, grid_offset, ~terrain);
+    map_desirability_tile_changed(grid_offset, terrain);
 }
 void map_terrain_add_with_radius(int x, int y, int size, int radius, int terrain) {
     int x_min, y_min, x_max, y_max;
@@ -66,6 +73,7 @@ void map_terrain_remove_with_radius(int x, int y, int size, int radius, int terr
 }
 void map_terrain_remove_all(int terrain) {
     map_grid_and_all(&terrain_grid, ~terrain);
+    map_desirability_all_tiles_changed(terrain);
 }
 
 int map_terrain_count_directly_adjacent_with_type(int grid_offset, int terrain) {
@@ -441,7 +449,12 @@ void map_terrain_backup(void) {
     map_grid_copy(&terrain_grid, &terrain_grid_backup);
 }
 void map_terrain_restore(void) {
-    map_grid_copy(&terrain_grid_backup, &terrain_grid);
+    // keep the current fountain range: the water supply does not know the backup's
+    for (int i = 0; i < grid_total_size[get_game_engine()]; i++) {
+        int range = (int) map_grid_get(&terrain_grid, i) & TERRAIN_FOUNTAIN_RANGE;
+        map_grid_set(&terrain_grid, i, ((int) map_grid_get(&terrain_grid_backup, i) & ~TERRAIN_FOUNTAIN_RANGE) | range);
+    }
+    map_desirability_all_tiles_changed(TERRAIN_ALL);
 }
 void map_terrain_clear(void) {
     map_grid_clear(&terrain_grid);
@@ -29,47 +29,162 @@ static struct {
     int tail;
 } queue;
 
-static void mark_well_access(int well_id, int radius) {
-    building *well = building_get(well_id);
+enum {
+    COVERAGE_FOUNTAIN = 0,
+    COVERAGE_WELL = 1,
+    MAX_COVERAGE = 2
+};
+
+typedef struct {
+    int active;
+    int x;
+    int y;
+    int size;
+    int radius;
+} coverage_source;
+
+// number of active sources covering each tile, kept up to date as sources change
+static grid_xx coverage_counts[MAX_COVERAGE] = {
+        {0, {FS_UINT16, FS_UINT16}},
+        {0, {FS_UINT16, FS_UINT16}}
+};
+
+static struct {
+    int needs_rebuild;
+    coverage_source sources[MAX_COVERAGE][4000];
+    // buildings whose wells have to be registered again
+    uint8_t source_dirty[4000];
+    int dirty_sources[4000];
+    int num_dirty_sources;
+    // buildings whose water and well access have to be derived again
+    uint8_t access_dirty[4000];
+    int dirty_access[4000];
+    int num_dirty_access;
+} coverage = {1};
+
+static void access_changed(int building_id) {
+    if (building_id <= 0 || building_id >= MAX_BUILDINGS[1] || coverage.access_dirty[building_id])
+        return;
+    coverage.access_dirty[building_id] = 1;
+    coverage.dirty_access[coverage.num_dirty_access++] = building_id;
+}
+static void apply_coverage(int kind, const coverage_source *src, int delta) {
     int x_min, y_min, x_max, y_max;
-    map_grid_get_area(well->x, well->y, 1, radius, &x_min, &y_min, &x_max, &y_max);
+    map_grid_get_area(src->x, src->y, src->size, src->radius, &x_min, &y_min, &x_max, &y_max);
 
     for (int yy = y_min; yy <= y_max; yy++) {
         for (int xx = x_min; xx <= x_max; xx++) {
-            int building_id = map_building_at(map_grid_offset(xx, yy));
-            if (building_id)
-                building_get(building_id)->has_well_access = 1;
-
+            int grid_offset = map_grid_offset(xx, yy);
+            int count = (int) map_grid_get(&coverage_counts[kind], grid_offset) + delta;
+            map_grid_set(&coverage_counts[kind], grid_offset, count);
+            // only a tile that gains its first source or loses its last one changes anything
+            if (count != (delta > 0 ? 1 : 0))
+                continue;
+            if (kind == COVERAGE_FOUNTAIN) {
+                if (count)
+                    map_terrain_add(grid_offset, TERRAIN_FOUNTAIN_RANGE);
+                else
+                    map_terrain_remove(grid_offset, TERRAIN_FOUNTAIN_RANGE);
+            }
+            access_changed(map_building_at(grid_offset));
+        }
+    }
+}
+static void set_coverage_source(int kind, int building_id, int x, int y, int size, int radius) {
+    coverage_source *src = &coverage.sources[kind][building_id];
+    if (src->active && src->x == x && src->y == y && src->size == size && src->radius == radius)
+        return;
+    if (src->active)
+        apply_coverage(kind, src, -1);
+    src->active = 1;
+    src->x = x;
+    src->y = y;
+    src->size = size;
+    src->radius = radius;
+    apply_coverage(kind, src, 1);
+}
+static void clear_coverage_source(int kind, int building_id) {
+    coverage_source *src = &coverage.sources[kind][building_id];
+    if (src->active) {
+        apply_coverage(kind, src, -1);
+        src->active = 0;
+    }
+}
+static int has_coverage_in_area(int kind, int x, int y, int size) {
+    for (int yy = y; yy < y + size; yy++) {
+        for (int xx = x; xx < x + size; xx++) {
+            if (map_grid_is_inside(xx, yy, 1) && map_grid_get(&coverage_counts[kind], map_grid_offset(xx, yy)))
+                return 1;
         }
     }
+    return 0;
+}
+static void rebuild_coverage(void) {
+    map_grid_clear(&coverage_counts[COVERAGE_FOUNTAIN]);
+    map_grid_clear(&coverage_counts[COVERAGE_WELL]);
+    memset(coverage.sources, 0, sizeof(coverage.sources));
+    memset(coverage.source_dirty, 0, sizeof(coverage.source_dirty));
+    memset(coverage.access_dirty, 0, sizeof(coverage.access_dirty));
+    coverage.num_dirty_sources = 0;
+    coverage.num_dirty_access = 0;
+    map_terrain_remove_all(TERRAIN_FOUNTAIN_RANGE);
+    // every building of the new map is registered once, after that only changes are
+    int max_id = building_get_highest_id();
+    for (int i = 1; i <= max_id && i < MAX_BUILDINGS[get_game_engine()]; i++)
+        map_water_supply_building_changed(i);
+    coverage.needs_rebuild = 0;
+}
+static void update_well(int building_id) {
+    // wells cover houses in a small range in both games, and provide the fountain range in Pharaoh
+    building *b = building_get(building_id);
+    if (b->state == BUILDING_STATE_VALID && b->type == BUILDING_WELL) {
+        set_coverage_source(COVERAGE_WELL, building_id, b->x, b->y, 1, get_game_engine() == ENGINE_ENV_C3 ? 2 : 1);
+        if (get_game_engine() == ENGINE_ENV_PHARAOH)
+            set_coverage_source(COVERAGE_FOUNTAIN, building_id, b->x, b->y, 1, 3);
+    } else {
+        clear_coverage_source(COVERAGE_WELL, building_id);
+        if (get_game_engine() == ENGINE_ENV_PHARAOH)
+            clear_coverage_source(COVERAGE_FOUNTAIN, building_id);
+    }
+}
+static void update_sources(void) {
+    if (coverage.needs_rebuild)
+        rebuild_coverage();
+    for (int i = 0; i < coverage.num_dirty_sources; i++) {
+        int id = coverage.dirty_sources[i];
+        update_well(id);
+        coverage.source_dirty[id] = 0;
+    }
+    coverage.num_dirty_sources = 0;
+}
+
+void map_water_supply_clear(void) {
+    coverage.needs_rebuild = 1;
+}
+void map_water_supply_building_changed(int building_id) {
+    if (building_id <= 0 || building_id >= MAX_BUILDINGS[1])
+        return;
+    access_changed(building_id);
+    if (!coverage.source_dirty[building_id]) {
+        coverage.source_dirty[building_id] = 1;
+        coverage.dirty_sources[coverage.num_dirty_sources++] = building_id;
+    }
 }
 
 void map_water_supply_update_houses(void) {
-    building_list_small_clear();
-    for (int i = 1; i < MAX_BUILDINGS[get_game_engine()]; i++) {
-        building *b = building_get(i);
+    update_sources();
+    for (int i = 0; i < coverage.num_dirty_access; i++) {
+        int id = coverage.dirty_access[i];
+        coverage.access_dirty[id] = 0;
+        building *b = building_get(id);
         if (b->state != BUILDING_STATE_VALID)
             continue;
 
-        if (b->type == BUILDING_WELL)
-            building_list_small_add(i);
-        else if (b->house_size) {
-            b->has_water_access = 0;
-            b->has_well_access = 0;
-            if (b->data.house.bathhouse || map_terrain_exists_tile_in_area_with_type(
-                    b->x, b->y, b->size, TERRAIN_FOUNTAIN_RANGE)) {
-                b->has_water_access = 1;
-            }
-        }
-    }
-    int total_wells = building_list_small_size();
-    const int *wells = building_list_small_items();
-    for (int i = 0; i < total_wells; i++) {
-        if (get_game_engine() == ENGINE_ENV_C3)
-            mark_well_access(wells[i], 2);
-        else if (get_game_engine() == ENGINE_ENV_PHARAOH)
-            mark_well_access(wells[i], 1);
+        if (b->house_size)
+            b->has_water_access = b->data.house.bathhouse || has_coverage_in_area(COVERAGE_FOUNTAIN, b->x, b->y, b->size);
+        b->has_well_access = has_coverage_in_area(COVERAGE_WELL, b->x, b->y, b->size);
     }
+    coverage.num_dirty_access = 0;
 }
 
 static void set_all_aqueducts_to_no_water(void) {
@@ -154,7 +269,8 @@ static int OFFSET(int x, int y) {
 }
 
 void map_water_supply_update_reservoir_fountain_C3(void) {
-    map_terrain_remove_all(TERRAIN_FOUNTAIN_RANGE | TERRAIN_GROUNDWATER);
+    update_sources();
+    map_terrain_remove_all(TERRAIN_GROUNDWATER);
     // reservoirs
     set_all_aqueducts_to_no_water();
     building_list_large_clear(1);
@@ -196,8 +312,10 @@ void map_water_supply_update_reservoir_fountain_C3(void) {
     // fountains
     for (int i = 1; i < MAX_BUILDINGS[get_game_engine()]; i++) {
         building *b = building_get(i);
-        if (b->state != BUILDING_STATE_VALID || b->type != BUILDING_FOUNTAIN)
+        if (b->state != BUILDING_STATE_VALID || b->type != BUILDING_FOUNTAIN) {
+            clear_coverage_source(COVERAGE_FOUNTAIN, i);
             continue;
+        }
 
         int des = map_desirability_get(b->grid_offset);
         int image_id;
@@ -212,22 +330,16 @@ void map_water_supply_update_reservoir_fountain_C3(void) {
         map_building_tiles_add(i, b->x, b->y, 1, image_id, TERRAIN_BUILDING);
         if (map_terrain_is(b->grid_offset, TERRAIN_GROUNDWATER) && b->num_workers) {
             b->has_water_access = 1;
-            map_terrain_add_with_radius(b->x, b->y, 1,
-                                        scenario_property_climate() == CLIMATE_DESERT ? 3 : 4,
-                                        TERRAIN_FOUNTAIN_RANGE);
-        } else
+            set_coverage_source(COVERAGE_FOUNTAIN, i, b->x, b->y, 1,
+                                scenario_property_climate() == CLIMATE_DESERT ? 3 : 4);
+        } else {
             b->has_water_access = 0;
+            clear_coverage_source(COVERAGE_FOUNTAIN, i);
+        }
     }
 }
 void map_water_supply_update_wells_PH(void) {
-    map_terrain_remove_all(TERRAIN_FOUNTAIN_RANGE);
-    int total_wells = building_list_small_size();
-    const int *wells = building_list_small_items();
-    for (int i = 0; i < total_wells; i++) {
-        building *b = building_get(wells[i]);
-        if (b->type == BUILDING_WELL)
-            map_terrain_add_with_radius(b->x, b->y, 1, 3, TERRAIN_FOUNTAIN_RANGE);
-    }
+    update_sources();
 }
 
 int map_water_supply_is_well_unnecessary(int well_id, int radius) {
@@ -1,6 +1,18 @@
 #ifndef MAP_WATER_SUPPLY_H
 #define MAP_WATER_SUPPLY_H
 
+/**
+ * Forgets the fountain and well coverage, it is rebuilt on the next update
+ */
+void map_water_supply_clear(void);
+
+/**
+ * Marks a building whose state, footprint or bathhouse access changed, so that its well
+ * and the water access of the buildings around it are updated on the next update
+ * @param building_id Building
+ */
+void map_water_supply_building_changed(int building_id);
+
 void map_water_supply_update_houses(void);
 void map_water_supply_update_reservoir_fountain_C3(void);
 void map_water_supply_update_wells_PH(void);
@@ -170,6 +170,18 @@ int platform_file_manager_remove_file(const char *filename) {
     return result == 0;
 }
 
+int platform_file_manager_get_file_info(const char *filename, long *size, long long *mtime) {
+    char *resolved_path = vita_prepend_path(filename);
+    struct stat file_info;
+    int result = stat(resolved_path, &file_info);
+    free(resolved_path);
+    if (result == -1)
+        return 0;
+    *size = file_info.st_size;
+    *mtime = file_info.st_mtime;
+    return 1;
+}
+
 #elif defined(_WIN32)
 
 FILE *platform_file_manager_open_file(const char *filename, const char *mode) {
@@ -191,6 +203,18 @@ int platform_file_manager_remove_file(const char *filename) {
     return result == 0;
 }
 
+int platform_file_manager_get_file_info(const char *filename, long *size, long long *mtime) {
+    wchar_t *wfile = utf8_to_wchar(filename);
+    struct _stat64 file_info;
+    int result = _wstat64(wfile, &file_info);
+    free(wfile);
+    if (result == -1)
+        return 0;
+    *size = (long) file_info.st_size;
+    *mtime = file_info.st_mtime;
+    return 1;
+}
+
 #else
 
 FILE *platform_file_manager_open_file(const char *filename, const char *mode) {
@@ -201,4 +225,13 @@ int platform_file_manager_remove_file(const char *filename) {
     return remove(filename) == 0;
 }
 
+int platform_file_manager_get_file_info(const char *filename, long *size, long long *mtime) {
+    struct stat file_info;
+    if (stat(filename, &file_info) == -1)
+        return 0;
+    *size = file_info.st_size;
+    *mtime = file_info.st_mtime;
+    return 1;
+}
+
 #endif
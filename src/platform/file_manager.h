@@ -49,6 +49,15 @@ int platform_file_manager_should_case_correct_file(void);
  */
 FILE *platform_file_manager_open_file(const char *filename, const char *mode);
 
+/**
+ * Gets the size and last modification time of a file
+ * @param filename The file to query
+ * @param size Output: size of the file in bytes
+ * @param mtime Output: last modification time, in seconds
+ * @return true if the file exists, false otherwise
+ */
+int platform_file_manager_get_file_info(const char *filename, long *size, long long *mtime);
+
 /**
  * Removes a file
  * @param filename The file to remove
@@ -0,0 +1,147 @@
+#include "jobs.h"
+
+#include "core/log.h"
+
+#include "SDL.h"
+
+#include <stdint.h>
+
+// below this many items per worker, waking up the threads costs more than it saves
+#define MIN_ITEMS_PER_WORKER 128
+
+static struct {
+    int initialized;
+    int num_workers;
+    int busy;
+    int quit;
+    SDL_Thread *threads[PLATFORM_JOBS_MAX_WORKERS];
+    SDL_mutex *mutex;
+    SDL_cond *work_ready;
+    SDL_cond *work_done;
+    unsigned int generation;
+    int remaining;
+    int count;
+    int chunks;
+    platform_job_body body;
+    void *user_data;
+} pool;
+
+// guards the lazy pool creation, which can't use pool.mutex since that is created there
+static SDL_SpinLock init_lock;
+
+static void run_chunk(int worker) {
+    int begin = (int) ((long long) pool.count * worker / pool.chunks);
+    int end = (int) ((long long) pool.count * (worker + 1) / pool.chunks);
+    if (begin < end)
+        pool.body(worker, begin, end, pool.user_data);
+}
+static int worker_main(void *arg) {
+    int worker = (int) (intptr_t) arg;
+    unsigned int seen = 0;
+    SDL_LockMutex(pool.mutex);
+    while (1) {
+        while (pool.generation == seen && !pool.quit)
+            SDL_CondWait(pool.work_ready, pool.mutex);
+        if (pool.quit)
+            break;
+        seen = pool.generation;
+        int has_work = worker < pool.chunks;
+        SDL_UnlockMutex(pool.mutex);
+        if (has_work)
+            run_chunk(worker);
+        SDL_LockMutex(pool.mutex);
+        if (--pool.remaining == 0)
+            SDL_CondSignal(pool.work_done);
+    }
+    SDL_UnlockMutex(pool.mutex);
+    return 0;
+}
+static void init_pool(void) {
+    pool.initialized = 1;
+    pool.num_workers = 1;
+    int cpus = SDL_GetCPUCount();
+    if (cpus > PLATFORM_JOBS_MAX_WORKERS)
+        cpus = PLATFORM_JOBS_MAX_WORKERS;
+    if (cpus <= 1)
+        return;
+    pool.mutex = SDL_CreateMutex();
+    pool.work_ready = SDL_CreateCond();
+    pool.work_done = SDL_CreateCond();
+    if (!pool.mutex || !pool.work_ready || !pool.work_done) {
+        log_error("Unable to create job system locks", SDL_GetError(), 0);
+        return;
+    }
+    for (int i = 1; i < cpus; i++) {
+        pool.threads[i] = SDL_CreateThread(worker_main, "jobs", (void *) (intptr_t) i);
+        if (!pool.threads[i]) {
+            log_error("Unable to create job thread", SDL_GetError(), i);
+            break;
+        }
+        pool.num_workers++;
+    }
+    log_info("Job system workers:", 0, pool.num_workers);
+}
+
+void platform_jobs_parallel_for(int count, platform_job_body body, void *user_data) {
+    platform_jobs_parallel_for_grain(count, MIN_ITEMS_PER_WORKER, body, user_data);
+}
+
+void platform_jobs_parallel_for_grain(int count, int min_items_per_worker, platform_job_body body, void *user_data) {
+    if (count <= 0)
+        return;
+    SDL_AtomicLock(&init_lock);
+    if (!pool.initialized)
+        init_pool();
+    int num_workers = pool.num_workers;
+    SDL_AtomicUnlock(&init_lock);
+    if (min_items_per_worker < 1)
+        min_items_per_worker = 1;
+    int chunks = count / min_items_per_worker;
+    if (chunks > num_workers)
+        chunks = num_workers;
+    if (chunks <= 1) {
+        body(0, 0, count, user_data);
+        return;
+    }
+    SDL_LockMutex(pool.mutex);
+    if (pool.busy) {
+        // nested call from a body, or another thread already owns the workers
+        SDL_UnlockMutex(pool.mutex);
+        body(0, 0, count, user_data);
+        return;
+    }
+    pool.busy = 1;
+    pool.count = count;
+    pool.chunks = chunks;
+    pool.body = body;
+    pool.user_data = user_data;
+    pool.remaining = pool.num_workers - 1;
+    pool.generation++;
+    SDL_CondBroadcast(pool.work_ready);
+    SDL_UnlockMutex(pool.mutex);
+
+    run_chunk(0);
+
+    SDL_LockMutex(pool.mutex);
+    while (pool.remaining > 0)
+        SDL_CondWait(pool.work_done, pool.mutex);
+    pool.busy = 0;
+    SDL_UnlockMutex(pool.mutex);
+}
+
+void platform_jobs_shutdown(void) {
+    SDL_AtomicLock(&init_lock);
+    // later loops run on the calling thread
+    pool.initialized = 1;
+    int num_workers = pool.num_workers;
+    pool.num_workers = 1;
+    SDL_AtomicUnlock(&init_lock);
+    if (num_workers <= 1)
+        return;
+    SDL_LockMutex(pool.mutex);
+    pool.quit = 1;
+    SDL_CondBroadcast(pool.work_ready);
+    SDL_UnlockMutex(pool.mutex);
+    for (int i = 1; i < num_workers; i++)
+        SDL_WaitThread(pool.threads[i], NULL);
+}
@@ -0,0 +1,43 @@
+#ifndef PLATFORM_JOBS_H
+#define PLATFORM_JOBS_H
+
+#define PLATFORM_JOBS_MAX_WORKERS 8
+
+/**
+ * Body of a parallel loop: processes items [begin, end) on the given worker
+ * @param worker Worker index, from 0 to PLATFORM_JOBS_MAX_WORKERS - 1
+ * @param begin First item
+ * @param end One past the last item
+ * @param user_data Data passed to platform_jobs_parallel_for
+ */
+typedef void (*platform_job_body)(int worker, int begin, int end, void *user_data);
+
+/**
+ * Splits [0, count) into contiguous chunks, one per worker, and runs them in parallel.
+ * Returns when all chunks are done. Worker 0 always runs on the calling thread, and worker w
+ * always gets items before worker w + 1, so per-worker partial results reduced in worker
+ * order give the same result as a serial loop.
+ * Falls back to running on the calling thread for small loops, nested calls, or while another
+ * thread's loop is using the workers. Safe to call from any thread.
+ * @param count Number of items
+ * @param body Function to run for each chunk
+ * @param user_data Passed to the body
+ */
+void platform_jobs_parallel_for(int count, platform_job_body body, void *user_data);
+
+/**
+ * Same as platform_jobs_parallel_for, for loops whose items are expensive enough (e.g. decoding
+ * a file) that a few of them already make a worthwhile chunk
+ * @param count Number of items
+ * @param min_items_per_worker Smallest number of items worth handing to a worker
+ * @param body Function to run for each chunk
+ * @param user_data Passed to the body
+ */
+void platform_jobs_parallel_for_grain(int count, int min_items_per_worker, platform_job_body body, void *user_data);
+
+/**
+ * Stops the worker threads. No loop may be running. Later loops run on the calling thread.
+ */
+void platform_jobs_shutdown(void);
+
+#endif // PLATFORM_JOBS_H
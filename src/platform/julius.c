@@ -7,12 +7,14 @@
 #include "core/time.h"
 #include "core/game_environment.h"
 #include "game/game.h"
+#include "game/startup.h"
 #include "game/system.h"
 #include "input/mouse.h"
 #include "input/touch.h"
 #include "platform/arguments.h"
 #include "platform/cursor.h"
 #include "platform/file_manager.h"
+#include "platform/jobs.h"
 #include "platform/keyboard_input.h"
 #include "platform/platform.h"
 #include "platform/prefs.h"
@@ -243,6 +245,7 @@ static void setup(const julius_args *args) {
     signal(SIGSEGV, handler);
     setup_logging();
     SDL_Log("Augustus version %s", system_version());
+    game_startup_stage("SDL");
     if (!init_sdl()) {
         SDL_Log("Exiting: SDL init failed");
         exit(-1);
@@ -255,6 +258,7 @@ static void setup(const julius_args *args) {
     init_debug_mode(args->debug);
 
     // pre-init engine: assert game directory, pref files, etc.
+    game_startup_stage("language and settings");
     init_game_environment(args->game_engine_env);
     if (!pre_init(args->data_directory)) {
         SDL_Log("Exiting: game pre-init failed");
@@ -265,6 +269,7 @@ static void setup(const julius_args *args) {
     goto skip;
 #endif
     // set up game display
+    game_startup_stage("window");
     char title[100];
     encoding_to_utf8(lang_get_string(9, 0), title, 100, 0);
     if (!platform_screen_create(title, args->display_scale_percentage)) {
@@ -285,6 +290,7 @@ static void setup(const julius_args *args) {
 static void teardown(void) {
     SDL_Log("Exiting game");
     game_exit();
+    platform_jobs_shutdown();
     platform_screen_destroy();
     SDL_Quit();
     teardown_logging();
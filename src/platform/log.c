@@ -5,9 +5,8 @@
 
 #define MSG_SIZE 1000
 
-static char log_buffer[MSG_SIZE];
-
-static const char *build_message(const char *msg, const char *param_str, int param_int) {
+// messages are built on the caller's stack: assets are loaded from several threads at startup
+static const char *build_message(char *log_buffer, const char *msg, const char *param_str, int param_int) {
     int index = 0;
     index += snprintf(&log_buffer[index], MSG_SIZE - index, "%s", msg);
     if (param_str)
@@ -20,9 +19,11 @@ static const char *build_message(const char *msg, const char *param_str, int par
 }
 
 void log_info(const char *msg, const char *param_str, int param_int) {
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", build_message(msg, param_str, param_int));
+    char log_buffer[MSG_SIZE];
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", build_message(log_buffer, msg, param_str, param_int));
 }
 
 void log_error(const char *msg, const char *param_str, int param_int) {
-    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s", build_message(msg, param_str, param_int));
+    char log_buffer[MSG_SIZE];
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s", build_message(log_buffer, msg, param_str, param_int));
 }
@@ -3,4 +3,10 @@
 
 int platform_sdl_version_at_least(int major, int minor, int patch);
 
+/**
+ * Gets the wall clock time, unlike time_get_millis which only changes once per frame
+ * @return Milliseconds since the platform was initialized
+ */
+unsigned int platform_get_millis(void);
+
 #endif // PLATFORM_PLATFORM_H
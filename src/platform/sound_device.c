@@ -22,6 +22,9 @@
 
 #define MAX_CHANNELS 150
 
+// decoded sound effects kept in memory, beyond this the least recently used ones are freed
+#define CHUNK_MEMORY_BUDGET (24 * 1024 * 1024)
+
 #if SDL_VERSION_ATLEAST(2, 0, 7)
 #define USE_SDL_AUDIOSTREAM
 #endif
@@ -38,14 +41,30 @@ static struct {
 typedef struct {
     const char *filename;
     Mix_Chunk *chunk;
+    Mix_Chunk *prefetched;
+    int is_queued;
+    unsigned int last_used;
 } sound_channel;
 
 static struct {
     int initialized;
     Mix_Music *music;
     sound_channel channels[MAX_CHANNELS];
+    unsigned int use_counter;
+    int loaded_bytes;
 } data;
 
+// channel files are decoded on a background thread so that playing them does not touch the disk
+static struct {
+    SDL_Thread *thread;
+    SDL_mutex *mutex;
+    SDL_cond *cond;
+    int queue[MAX_CHANNELS];
+    int head;
+    int count;
+    int quit;
+} prefetch;
+
 static struct {
     SDL_AudioFormat format;
 #ifdef USE_SDL_AUDIOSTREAM
@@ -80,18 +99,132 @@ static Mix_Chunk *load_chunk(const char *filename) {
     }
 }
 
-static int load_channel(sound_channel *channel) {
-    if (!channel->chunk && channel->filename)
-        channel->chunk = load_chunk(channel->filename);
+static int chunk_size(const Mix_Chunk *chunk) {
+    return chunk ? (int) chunk->alen : 0;
+}
+
+static int run_prefetch(void *unused) {
+    SDL_LockMutex(prefetch.mutex);
+    while (!prefetch.quit) {
+        if (!prefetch.count) {
+            SDL_CondWait(prefetch.cond, prefetch.mutex);
+            continue;
+        }
+        sound_channel *channel = &data.channels[prefetch.queue[prefetch.head]];
+        prefetch.head = (prefetch.head + 1) % MAX_CHANNELS;
+        prefetch.count--;
+        if (!channel->is_queued)
+            continue;
+        if (data.loaded_bytes >= CHUNK_MEMORY_BUDGET) {
+            channel->is_queued = 0;
+            continue;
+        }
+        SDL_UnlockMutex(prefetch.mutex);
+
+        Mix_Chunk *chunk = load_chunk(channel->filename);
 
-    return channel->chunk ? 1 : 0;
+        SDL_LockMutex(prefetch.mutex);
+        if (chunk && channel->is_queued) {
+            channel->prefetched = chunk;
+            data.loaded_bytes += chunk_size(chunk);
+        } else if (chunk) {
+            // the channel was loaded directly in the meantime
+            Mix_FreeChunk(chunk);
+        }
+        channel->is_queued = 0;
+    }
+    SDL_UnlockMutex(prefetch.mutex);
+    return 0;
+}
+
+static void stop_prefetch(void) {
+    if (prefetch.thread) {
+        SDL_LockMutex(prefetch.mutex);
+        prefetch.quit = 1;
+        SDL_CondSignal(prefetch.cond);
+        SDL_UnlockMutex(prefetch.mutex);
+        SDL_WaitThread(prefetch.thread, 0);
+        prefetch.thread = 0;
+    }
+    prefetch.head = 0;
+    prefetch.count = 0;
+    prefetch.quit = 0;
+}
+
+static void free_channel_chunk(int index) {
+    sound_channel *channel = &data.channels[index];
+    if (channel->chunk) {
+        Mix_HaltChannel(index);
+        if (channel->filename)
+            data.loaded_bytes -= chunk_size(channel->chunk);
+        Mix_FreeChunk(channel->chunk);
+        channel->chunk = 0;
+    }
+    if (channel->prefetched) {
+        data.loaded_bytes -= chunk_size(channel->prefetched);
+        Mix_FreeChunk(channel->prefetched);
+        channel->prefetched = 0;
+    }
+}
+
+static void evict_unused_chunks(int keep) {
+    SDL_LockMutex(prefetch.mutex);
+    while (data.loaded_bytes > CHUNK_MEMORY_BUDGET) {
+        int oldest = -1;
+        for (int i = 0; i < MAX_CHANNELS; i++) {
+            sound_channel *channel = &data.channels[i];
+            if (i == keep || !channel->filename || (!channel->chunk && !channel->prefetched))
+                continue;
+            if (channel->chunk && Mix_Playing(i))
+                continue;
+            if (oldest < 0 || channel->last_used < data.channels[oldest].last_used)
+                oldest = i;
+        }
+        if (oldest < 0)
+            break;
+        free_channel_chunk(oldest);
+    }
+    SDL_UnlockMutex(prefetch.mutex);
+}
+
+static int load_channel(int index) {
+    sound_channel *channel = &data.channels[index];
+    channel->last_used = ++data.use_counter;
+    if (channel->chunk)
+        return 1;
+    if (!channel->filename)
+        return 0;
+
+    SDL_LockMutex(prefetch.mutex);
+    channel->chunk = channel->prefetched;
+    channel->prefetched = 0;
+    channel->is_queued = 0;
+    SDL_UnlockMutex(prefetch.mutex);
+
+    if (!channel->chunk) {
+        channel->chunk = load_chunk(channel->filename);
+        if (!channel->chunk)
+            return 0;
+        SDL_LockMutex(prefetch.mutex);
+        data.loaded_bytes += chunk_size(channel->chunk);
+        SDL_UnlockMutex(prefetch.mutex);
+    }
+    evict_unused_chunks(index);
+    return 1;
 }
 
 static void init_channels(void) {
     data.initialized = 1;
+    data.loaded_bytes = 0;
     for (int i = 0; i < MAX_CHANNELS; i++) {
         data.channels[i].chunk = 0;
+        data.channels[i].prefetched = 0;
+        data.channels[i].is_queued = 0;
     }
+    if (!prefetch.mutex)
+        prefetch.mutex = SDL_CreateMutex();
+    if (!prefetch.cond)
+        prefetch.cond = SDL_CreateCond();
 }
 
 void sound_device_init_channels(int num_channels, char filenames[][CHANNEL_FILENAME_MAX]) {
@@ -109,6 +242,31 @@ void sound_device_init_channels(int num_channels, char filenames[][CHANNEL_FILEN
     }
 }
 
+void sound_device_prefetch_channels(int first, int last) {
+    if (!data.initialized || !prefetch.mutex || !prefetch.cond)
+        return;
+    if (last >= MAX_CHANNELS)
+        last = MAX_CHANNELS - 1;
+    if (!prefetch.thread) {
+        prefetch.thread = SDL_CreateThread(run_prefetch, "sound_prefetch", 0);
+        if (!prefetch.thread) {
+            log_error("Unable to start sound prefetch thread", SDL_GetError(), 0);
+            return;
+        }
+    }
+    SDL_LockMutex(prefetch.mutex);
+    for (int i = first; i <= last; i++) {
+        sound_channel *channel = &data.channels[i];
+        if (!channel->filename || channel->chunk || channel->prefetched || channel->is_queued)
+            continue;
+        channel->is_queued = 1;
+        prefetch.queue[(prefetch.head + prefetch.count) % MAX_CHANNELS] = i;
+        prefetch.count++;
+    }
+    SDL_CondSignal(prefetch.cond);
+    SDL_UnlockMutex(prefetch.mutex);
+}
+
 void sound_device_open(void) {
 #ifdef USE_SDL_AUDIOSTREAM
     custom_music.use_audiostream = HAS_AUDIOSTREAM();
@@ -144,8 +302,9 @@ void sound_device_open(void) {
 
 void sound_device_close(void) {
     if (data.initialized) {
+        stop_prefetch();
         for (int i = 0; i < MAX_CHANNELS; i++) {
-            sound_device_stop_channel(i);
+            free_channel_chunk(i);
         }
         Mix_CloseAudio();
         data.initialized = 0;
@@ -232,7 +391,7 @@ void sound_device_play_file_on_channel(const char *filename, int channel, int vo
 void sound_device_play_channel(int channel, int volume_pct) {
     if (data.initialized) {
         sound_channel *ch = &data.channels[channel];
-        if (load_channel(ch)) {
+        if (load_channel(channel)) {
 
             switch (get_game_engine()) {
                 const char *mp3_track;
@@ -251,7 +410,7 @@ void sound_device_play_channel(int channel, int volume_pct) {
 void sound_device_play_channel_panned(int channel, int volume_pct, int left_pct, int right_pct) {
     if (data.initialized) {
         sound_channel *ch = &data.channels[channel];
-        if (load_channel(ch)) {
+        if (load_channel(channel)) {
             Mix_SetPanning(channel, left_pct * 255 / 100, right_pct * 255 / 100);
             sound_device_set_channel_volume(channel, volume_pct);
             Mix_PlayChannel(channel, ch->chunk, 0);
@@ -274,8 +433,11 @@ void sound_device_stop_channel(int channel) {
         sound_channel *ch = &data.channels[channel];
         if (ch->chunk) {
             Mix_HaltChannel(channel);
-            Mix_FreeChunk(ch->chunk);
-            ch->chunk = 0;
+            // channel sounds stay cached, only one-off files are freed
+            if (!ch->filename) {
+                Mix_FreeChunk(ch->chunk);
+                ch->chunk = 0;
+            }
         }
     }
 }
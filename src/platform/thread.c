@@ -0,0 +1,44 @@
+#include "thread.h"
+
+#include "core/log.h"
+
+#include "SDL.h"
+
+platform_thread *platform_thread_create(int (*run)(void *user_data), const char *name, void *user_data) {
+    SDL_Thread *thread = SDL_CreateThread(run, name, user_data);
+    if (!thread)
+        log_error("Unable to create thread", SDL_GetError(), 0);
+    return (platform_thread *) thread;
+}
+void platform_thread_wait(platform_thread *thread) {
+    if (thread)
+        SDL_WaitThread((SDL_Thread *) thread, NULL);
+}
+
+platform_mutex *platform_mutex_create(void) {
+    return (platform_mutex *) SDL_CreateMutex();
+}
+void platform_mutex_lock(platform_mutex *mutex) {
+    SDL_LockMutex((SDL_mutex *) mutex);
+}
+void platform_mutex_unlock(platform_mutex *mutex) {
+    SDL_UnlockMutex((SDL_mutex *) mutex);
+}
+void platform_mutex_destroy(platform_mutex *mutex) {
+    if (mutex)
+        SDL_DestroyMutex((SDL_mutex *) mutex);
+}
+
+platform_cond *platform_cond_create(void) {
+    return (platform_cond *) SDL_CreateCond();
+}
+void platform_cond_wait(platform_cond *cond, platform_mutex *mutex) {
+    SDL_CondWait((SDL_cond *) cond, (SDL_mutex *) mutex);
+}
+void platform_cond_signal(platform_cond *cond) {
+    SDL_CondSignal((SDL_cond *) cond);
+}
+void platform_cond_destroy(platform_cond *cond) {
+    if (cond)
+        SDL_DestroyCond((SDL_cond *) cond);
+}
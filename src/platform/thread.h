@@ -0,0 +1,44 @@
+#ifndef PLATFORM_THREAD_H
+#define PLATFORM_THREAD_H
+
+/**
+ * @file
+ * Threads and locks for code outside the platform layer.
+ */
+
+typedef struct platform_thread platform_thread;
+typedef struct platform_mutex platform_mutex;
+typedef struct platform_cond platform_cond;
+
+/**
+ * Starts a thread
+ * @param run Function to run on the thread
+ * @param name Name of the thread, for debuggers
+ * @param user_data Passed to the function
+ * @return Thread, or 0 if it could not be started
+ */
+platform_thread *platform_thread_create(int (*run)(void *user_data), const char *name, void *user_data);
+
+/**
+ * Waits for a thread to finish and frees it
+ * @param thread Thread
+ */
+void platform_thread_wait(platform_thread *thread);
+
+platform_mutex *platform_mutex_create(void);
+void platform_mutex_lock(platform_mutex *mutex);
+void platform_mutex_unlock(platform_mutex *mutex);
+void platform_mutex_destroy(platform_mutex *mutex);
+
+platform_cond *platform_cond_create(void);
+
+/**
+ * Waits for the condition to be signaled, releasing the mutex while waiting
+ * @param cond Condition
+ * @param mutex Locked mutex
+ */
+void platform_cond_wait(platform_cond *cond, platform_mutex *mutex);
+void platform_cond_signal(platform_cond *cond);
+void platform_cond_destroy(platform_cond *cond);
+
+#endif // PLATFORM_THREAD_H
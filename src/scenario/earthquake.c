@@ -8,6 +8,8 @@
 #include "figuretype/missile.h"
 #include "game/time.h"
 #include "map/building.h"
+#include "map/desirability.h"
+#include "map/water_supply.h"
 #include "map/grid.h"
 #include "map/routing_terrain.h"
 #include "map/terrain.h"
@@ -74,6 +76,8 @@ static void advance_earthquake_to_tile(int x, int y) {
         int ruin_id = map_building_at(grid_offset);
         if (ruin_id) {
             building_get(ruin_id)->state = BUILDING_STATE_DELETED_BY_GAME;
+            map_desirability_building_changed(ruin_id);
+            map_water_supply_building_changed(ruin_id);
             map_building_set(grid_offset, 0);
         }
     }
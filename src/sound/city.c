@@ -200,6 +200,9 @@ void sound_city_init(void) {
     channels[61].channel = SOUND_CHANNEL_CITY_EMPTY_LAND;
     channels[62].channel = SOUND_CHANNEL_CITY_RIVER;
     channels[63].channel = SOUND_CHANNEL_CITY_MISSION_POST;
+
+    if (setting_sound(SOUND_CITY)->enabled)
+        sound_device_prefetch_channels(SOUND_CHANNEL_CITY_MIN, SOUND_CHANNEL_CITY_MAX);
 }
 void sound_city_set_volume(int percentage) {
     for (int i = SOUND_CHANNEL_CITY_MIN; i <= SOUND_CHANNEL_CITY_MAX; i++)
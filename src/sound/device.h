@@ -9,6 +9,14 @@ void sound_device_close(void);
 void sound_device_init_channels(int num_channels, char filenames[][CHANNEL_FILENAME_MAX]);
 int sound_device_is_channel_playing(int channel);
 
+/**
+ * Loads the sounds for a range of channels in the background, so that playing them later does not
+ * have to read and decode the file. Loaded sounds are kept within a memory budget.
+ * @param first First channel
+ * @param last Last channel, inclusive
+ */
+void sound_device_prefetch_channels(int first, int last);
+
 void sound_device_set_music_volume(int volume_pct);
 void sound_device_set_channel_volume(int channel, int volume_pct);
 
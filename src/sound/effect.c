@@ -1,5 +1,6 @@
 #include "effect.h"
 
+#include "game/forecast.h"
 #include "game/settings.h"
 #include "sound/channel.h"
 #include "sound/device.h"
@@ -11,7 +12,7 @@ void sound_effect_set_volume(int percentage) {
 }
 
 void sound_effect_play(int effect) {
-    if (!setting_sound(SOUND_EFFECTS)->enabled)
+    if (!setting_sound(SOUND_EFFECTS)->enabled || game_forecast_is_running())
         return;
     if (sound_device_is_channel_playing(effect))
         return;
@@ -349,6 +349,7 @@ void sound_system_init(void) {
 
     sound_device_open();
     sound_device_init_channels(SOUND_CHANNEL_MAX, channel_filenames[get_game_engine()]);
+    sound_device_prefetch_channels(SOUND_CHANNEL_EFFECTS_MIN, SOUND_CHANNEL_EFFECTS_MAX);
 
     sound_city_set_volume(setting_sound(SOUND_CITY)->volume);
     sound_effect_set_volume(setting_sound(SOUND_EFFECTS)->volume);
@@ -34,6 +34,7 @@ static translation_string all_strings[] = {
         {TR_CONFIG_PAGE_LABEL,                          "Page"},
         {TR_CONFIG_HEADER_UI_CHANGES,                   "User interface changes"},
         {TR_CONFIG_HEADER_GAMEPLAY_CHANGES,             "Gameplay changes"},
+        {TR_CONFIG_HEADER_FAST_FORWARD,                 "Fast forward"},
         {TR_CONFIG_SHOW_INTRO_VIDEO,                    "Play intro videos"},
         {TR_CONFIG_SIDEBAR_INFO,                        "Extra information in the control panel"},
         {TR_CONFIG_SMOOTH_SCROLLING,                    "Enable smooth scrolling"},
@@ -72,6 +73,11 @@ static translation_string all_strings[] = {
         {TR_CONFIG_MULTIPLE_BARRACKS,                   "Allow building multiple barracks."},
         {TR_CONFIG_NOT_ACCEPTING_WAREHOUSES,            "Warehouses don't accept anything when built"},
         {TR_CONFIG_HOUSES_DONT_EXPAND_INTO_GARDENS,     "Houses don't expand into gardens"},
+        {TR_CONFIG_LIMIT_ROUTES_PER_TICK,               "Spread walker route searches over several ticks"},
+        {TR_CONFIG_FAST_FORWARD_STOP_ON_MESSAGE,        "Stop fast forward on every message"},
+        {TR_CONFIG_FAST_FORWARD_STOP_ON_INVASION,       "Stop fast forward when an invasion is announced"},
+        {TR_CONFIG_FAST_FORWARD_STOP_ON_REQUEST,        "Stop fast forward on requests from Caesar"},
+        {TR_CONFIG_FAST_FORWARD_STOP_ON_POPULATION,     "Stop fast forward at the next thousand citizens"},
         {TR_HOTKEY_TITLE,                               "Augustus hotkey configuration"},
         {TR_HOTKEY_LABEL,                               "Hotkey"},
         {TR_HOTKEY_ALTERNATIVE_LABEL,                   "Alternative"},
@@ -96,9 +102,12 @@ static translation_string all_strings[] = {
         {TR_HOTKEY_SAVE_CITY_SCREENSHOT,                "Save full city screenshot"},
         {TR_HOTKEY_LOAD_FILE,                           "Load file"},
         {TR_HOTKEY_SAVE_FILE,                           "Save file"},
+        {TR_HOTKEY_QUICKSAVE,                           "Quicksave"},
+        {TR_HOTKEY_QUICKLOAD,                           "Quickload"},
         {TR_HOTKEY_INCREASE_GAME_SPEED,                 "Increase game speed"},
         {TR_HOTKEY_DECREASE_GAME_SPEED,                 "Decrease game speed"},
         {TR_HOTKEY_TOGGLE_PAUSE,                        "Toggle pause"},
+        {TR_HOTKEY_TOGGLE_FAST_FORWARD,                 "Toggle fast-forward"},
         {TR_HOTKEY_CYCLE_LEGION,                        "Cycle through legions"},
         {TR_HOTKEY_ROTATE_MAP_LEFT,                     "Rotate map left"},
         {TR_HOTKEY_ROTATE_MAP_RIGHT,                    "Rotate map right"},
@@ -154,7 +163,13 @@ static translation_string all_strings[] = {
         {TR_ADVISOR_PERCENT_IN_WORKFORCE,               "Percentage of your population in the workforce is"},
         {TR_ADVISOR_BIRTHS_LAST_YEAR,                   "Births last year:"},
         {TR_ADVISOR_DEATHS_LAST_YEAR,                   "Deaths last year:"},
-        {TR_ADVISOR_TOTAL_POPULATION,                   "residents total"}
+        {TR_ADVISOR_TOTAL_POPULATION,                   "residents total"},
+        {TR_ADVISOR_FORECAST_BUTTON,                    "Forecast the next year"},
+        {TR_ADVISOR_FORECAST_TREASURY,                  "Treasury in a year:"},
+        {TR_FORECAST_FAILED_TITLE,                      "Forecast failed"},
+        {TR_FORECAST_FAILED_MESSAGE,
+                                                        "The city could not be brought back to the present after the forecast. "
+                                                        "Load the saved game forecast.svx to continue from before the forecast."}
 };
 
 void translation_english(const translation_string **strings, int *num_strings) {
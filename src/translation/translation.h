@@ -26,6 +26,7 @@ enum {
     TR_CONFIG_PAGE_LABEL,
     TR_CONFIG_HEADER_UI_CHANGES,
     TR_CONFIG_HEADER_GAMEPLAY_CHANGES,
+    TR_CONFIG_HEADER_FAST_FORWARD,
     TR_CONFIG_SHOW_INTRO_VIDEO,
     TR_CONFIG_SIDEBAR_INFO,
     TR_CONFIG_SMOOTH_SCROLLING,
@@ -64,6 +65,11 @@ enum {
     TR_CONFIG_MULTIPLE_BARRACKS,
     TR_CONFIG_NOT_ACCEPTING_WAREHOUSES,
     TR_CONFIG_HOUSES_DONT_EXPAND_INTO_GARDENS,
+    TR_CONFIG_LIMIT_ROUTES_PER_TICK,
+    TR_CONFIG_FAST_FORWARD_STOP_ON_MESSAGE,
+    TR_CONFIG_FAST_FORWARD_STOP_ON_INVASION,
+    TR_CONFIG_FAST_FORWARD_STOP_ON_REQUEST,
+    TR_CONFIG_FAST_FORWARD_STOP_ON_POPULATION,
     TR_HOTKEY_TITLE,
     TR_HOTKEY_LABEL,
     TR_HOTKEY_ALTERNATIVE_LABEL,
@@ -88,9 +94,12 @@ enum {
     TR_HOTKEY_SAVE_CITY_SCREENSHOT,
     TR_HOTKEY_LOAD_FILE,
     TR_HOTKEY_SAVE_FILE,
+    TR_HOTKEY_QUICKSAVE,
+    TR_HOTKEY_QUICKLOAD,
     TR_HOTKEY_INCREASE_GAME_SPEED,
     TR_HOTKEY_DECREASE_GAME_SPEED,
     TR_HOTKEY_TOGGLE_PAUSE,
+    TR_HOTKEY_TOGGLE_FAST_FORWARD,
     TR_HOTKEY_CYCLE_LEGION,
     TR_HOTKEY_ROTATE_MAP_LEFT,
     TR_HOTKEY_ROTATE_MAP_RIGHT,
@@ -147,6 +156,10 @@ enum {
     TR_ADVISOR_BIRTHS_LAST_YEAR,
     TR_ADVISOR_DEATHS_LAST_YEAR,
     TR_ADVISOR_TOTAL_POPULATION,
+    TR_ADVISOR_FORECAST_BUTTON,
+    TR_ADVISOR_FORECAST_TREASURY,
+    TR_FORECAST_FAILED_TITLE,
+    TR_FORECAST_FAILED_MESSAGE,
     TRANSLATION_MAX_KEY
 };
 
@@ -2,24 +2,42 @@
 
 #include "city/finance.h"
 #include "core/calc.h"
+#include "game/forecast.h"
 #include "graphics/arrow_button.h"
+#include "graphics/button.h"
+#include "graphics/generic_button.h"
 #include "graphics/graphics.h"
 #include "graphics/image.h"
 #include "graphics/lang_text.h"
 #include "graphics/panel.h"
 #include "graphics/text.h"
 #include "graphics/window.h"
+#include "translation/translation.h"
+#include "window/plain_message_dialog.h"
 
-#define ADVISOR_HEIGHT 26
+#define ADVISOR_HEIGHT 28
+
+#define FORECAST_MONTHS 12
 
 static void button_change_taxes(int is_down, int param2);
+static void button_forecast(int param1, int param2);
 
 static arrow_button arrow_buttons_taxes[] = {
         {180, 75, 17, 24, button_change_taxes, 1, 0},
         {204, 75, 15, 24, button_change_taxes, 0, 0}
 };
 
+static generic_button forecast_button[] = {
+        {70, 404, 220, 20, button_forecast, button_none, 0, 0},
+};
+
 static int arrow_button_focus;
+static int focus_button_id;
+
+static struct {
+    int months;
+    int treasury;
+} forecast;
 
 static void draw_row(int group, int number, int y, int value_last_year, int value_this_year) {
     lang_text_draw(group, number, 80, y, FONT_NORMAL_BLACK);
@@ -93,15 +111,28 @@ static int draw_background(void) {
     draw_row(60, 18, 358, last_year->net_in_out, this_year->net_in_out);
     draw_row(60, 19, 381, last_year->balance, this_year->balance);
 
+    text_draw_centered(translation_for(TR_ADVISOR_FORECAST_BUTTON), 70, 409, 220, FONT_NORMAL_BLACK, 0);
+    if (forecast.months == FORECAST_MONTHS) {
+        width = text_draw(translation_for(TR_ADVISOR_FORECAST_TREASURY), 310, 409, FONT_NORMAL_BLACK, 0);
+        if (forecast.treasury < 0)
+            lang_text_draw_amount(8, 0, -forecast.treasury, 316 + width, 409, FONT_NORMAL_RED);
+        else {
+            lang_text_draw_amount(8, 0, forecast.treasury, 316 + width, 409, FONT_NORMAL_BLACK);
+        }
+    }
+
     return ADVISOR_HEIGHT;
 }
 
 static void draw_foreground(void) {
     arrow_buttons_draw(0, 0, arrow_buttons_taxes, 2);
+    button_border_draw(70, 404, 220, 20, focus_button_id == 1);
 }
 
 static int handle_mouse(const mouse *m) {
-    return arrow_buttons_handle_mouse(m, 0, 0, arrow_buttons_taxes, 2, &arrow_button_focus);
+    if (arrow_buttons_handle_mouse(m, 0, 0, arrow_buttons_taxes, 2, &arrow_button_focus))
+        return 1;
+    return generic_buttons_handle_mouse(m, 0, 0, forecast_button, 1, &focus_button_id);
 }
 
 static void button_change_taxes(int is_down, int param2) {
@@ -111,6 +142,18 @@ static void button_change_taxes(int is_down, int param2) {
     window_invalidate();
 }
 
+static void button_forecast(int param1, int param2) {
+    forecast_month results[FORECAST_MONTHS];
+    forecast.months = game_forecast_run(FORECAST_MONTHS, results);
+    if (forecast.months == FORECAST_RESTORE_FAILED) {
+        window_plain_message_dialog_show(TR_FORECAST_FAILED_TITLE, TR_FORECAST_FAILED_MESSAGE);
+        return;
+    }
+    if (forecast.months == FORECAST_MONTHS)
+        forecast.treasury = results[FORECAST_MONTHS - 1].treasury;
+    window_invalidate();
+}
+
 static int get_tooltip_text(void) {
     if (arrow_button_focus)
         return 120;
@@ -126,5 +169,7 @@ const advisor_window_type *window_advisor_financial(void) {
             handle_mouse,
             get_tooltip_text
     };
+    focus_button_id = 0;
+    forecast.months = 0;
     return &window;
 }
@@ -9,6 +9,8 @@
 #include "core/config.h"
 #include "core/image.h"
 #include "figure/formation.h"
+#include "game/fast_forward.h"
+#include "game/file.h"
 #include "game/orientation.h"
 #include "game/settings.h"
 #include "game/state.h"
@@ -175,6 +177,9 @@ static void handle_hotkeys(const hotkeys *h) {
     if (h->toggle_pause)
         toggle_pause();
 
+    if (h->toggle_fast_forward)
+        game_fast_forward_toggle();
+
 //    if (h->decrease_game_speed) {
 //        setting_decrease_game_speed();
 //    }
@@ -218,6 +223,12 @@ static void handle_hotkeys(const hotkeys *h) {
     if (h->save_file)
         window_file_dialog_show(FILE_TYPE_SAVED_GAME, FILE_DIALOG_SAVE);
 
+    if (h->quicksave)
+        game_file_write_quicksave();
+
+    if (h->quickload && game_file_load_quicksave())
+        window_city_show();
+
     if (h->rotate_building)
         building_rotation_rotate_by_hotkey();
 
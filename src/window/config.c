@@ -25,8 +25,7 @@
 #include "translation/translation.h"
 #include <string.h>
 
-#define NUM_CHECKBOXES 37
-#define CONFIG_PAGES 3
+#define CONFIG_PAGES 4
 #define MAX_LANGUAGE_DIRS 20
 
 #define FIRST_BUTTON_Y 72
@@ -42,7 +41,7 @@
 #define ITEM_Y_OFFSET 60
 #define ITEM_HEIGHT 24
 
-static int options_per_page[CONFIG_PAGES] = {11, 14, 12};
+static int options_per_page[CONFIG_PAGES] = {11, 14, 13, 4};
 
 static void toggle_switch(int id, int param2);
 static void button_language_select(int param1, int param2);
@@ -94,8 +93,15 @@ static generic_button checkbox_buttons[] = {
         {20, 288, 20, 20, toggle_switch, button_none, CONFIG_GP_CH_MULTIPLE_BARRACKS,                   TR_CONFIG_MULTIPLE_BARRACKS},
         {20, 312, 20, 20, toggle_switch, button_none, CONFIG_GP_CH_WAREHOUSES_DONT_ACCEPT,              TR_CONFIG_NOT_ACCEPTING_WAREHOUSES},
         {20, 336, 20, 20, toggle_switch, button_none, CONFIG_GP_CH_HOUSES_DONT_EXPAND_INTO_GARDENS,     TR_CONFIG_HOUSES_DONT_EXPAND_INTO_GARDENS},
+        {20, 360, 20, 20, toggle_switch, button_none, CONFIG_GP_CH_LIMIT_ROUTES_PER_TICK,               TR_CONFIG_LIMIT_ROUTES_PER_TICK},
+        {20, 72,  20, 20, toggle_switch, button_none, CONFIG_UI_FAST_FORWARD_STOP_ON_MESSAGE,           TR_CONFIG_FAST_FORWARD_STOP_ON_MESSAGE},
+        {20, 96,  20, 20, toggle_switch, button_none, CONFIG_UI_FAST_FORWARD_STOP_ON_INVASION,          TR_CONFIG_FAST_FORWARD_STOP_ON_INVASION},
+        {20, 120, 20, 20, toggle_switch, button_none, CONFIG_UI_FAST_FORWARD_STOP_ON_REQUEST,           TR_CONFIG_FAST_FORWARD_STOP_ON_REQUEST},
+        {20, 144, 20, 20, toggle_switch, button_none, CONFIG_UI_FAST_FORWARD_STOP_ON_POPULATION,        TR_CONFIG_FAST_FORWARD_STOP_ON_POPULATION},
 };
 
+#define NUM_CHECKBOXES (int) (sizeof(checkbox_buttons) / sizeof(*checkbox_buttons))
+
 static generic_button language_button = {
         120, 50, 200, 24, button_language_select, button_none, 0, TR_CONFIG_LANGUAGE_LABEL
 };
@@ -115,7 +121,8 @@ static generic_button page_buttons[] = {
 static int page_names[] = {
         TR_CONFIG_HEADER_UI_CHANGES,
         TR_CONFIG_HEADER_GAMEPLAY_CHANGES,
-        TR_CONFIG_HEADER_GAMEPLAY_CHANGES
+        TR_CONFIG_HEADER_GAMEPLAY_CHANGES,
+        TR_CONFIG_HEADER_FAST_FORWARD
 };
 
 static struct {
@@ -184,6 +191,7 @@ static int config_change_zoom(int key) {
     return 1;
 }
 static int config_change_string_language(int key) {
+    dir_invalidate_case_cache();
     config_set_string(CONFIG_STRING_UI_LANGUAGE_DIR, data.config_string_values[key].new_value);
     if (!game_reload_language()) {
         // Notify user that language dir is invalid and revert to previously selected
@@ -199,7 +207,8 @@ static int config_change_string_language(int key) {
 
 static int apply_changed_configs(void) {
     for (int i = 0; i < CONFIG_MAX_ENTRIES; ++i) {
-        if (config_changed(i)) {
+        // entries without a checkbox are not edited here
+        if (data.config_values[i].change_action && config_changed(i)) {
             if (!data.config_values[i].change_action(i))
                 return 0;
 
@@ -226,7 +235,8 @@ static void button_language_select(int param1, int param2) {
 }
 static void button_reset_defaults(int param1, int param2) {
     for (int i = 0; i < CONFIG_MAX_ENTRIES; ++i) {
-        data.config_values[i].new_value = config_get_default_value(i);
+        if (data.config_values[i].change_action)
+            data.config_values[i].new_value = config_get_default_value(i);
     }
     for (int i = 0; i < CONFIG_STRING_MAX_ENTRIES; ++i) {
         strncpy(data.config_string_values[i].new_value, config_get_default_string_value(i),
@@ -290,9 +300,9 @@ static void init(void) {
     data.starting_option = 0;
     for (int i = 0; i < NUM_CHECKBOXES; i++) {
         int key = checkbox_buttons[i].parameter1;
-        data.config_values[i].original_value = config_get(i);
-        data.config_values[i].new_value = config_get(i);
-        data.config_values[i].change_action = config_change_basic;
+        data.config_values[key].original_value = config_get(key);
+        data.config_values[key].new_value = config_get(key);
+        data.config_values[key].change_action = config_change_basic;
     }
     for (int i = 0; i < CONFIG_STRING_MAX_ENTRIES; i++) {
         const char *value = config_get_string(i);
@@ -11,6 +11,7 @@
 #include "core/game_environment.h"
 #include "game/file.h"
 #include "game/file_editor.h"
+#include "game/save_index.h"
 #include "graphics/generic_button.h"
 #include "graphics/graphics.h"
 #include "graphics/image.h"
@@ -82,6 +83,10 @@ static file_type_data scenario_data = {"map"};
 
 static int double_click = 0;
 
+static const char *saved_game_dir(void) {
+    return get_game_engine() == ENGINE_ENV_PHARAOH ? "Save/Banderus/" : ".";
+}
+
 static void init(file_type type, file_dialog_type dialog_type) {
     data.type = type;
     data.file_data = type == FILE_TYPE_SCENARIO ? &scenario_data : &saved_game_data;
@@ -120,16 +125,38 @@ static void init(file_type type, file_dialog_type dialog_type) {
             break;
     }
 
+    if (type == FILE_TYPE_SAVED_GAME)
+        game_save_index_refresh(saved_game_dir(), data.file_list);
+
     scrollbar_init(&scrollbar, 0, data.file_list->num_files - NUM_FILES_IN_VIEW);
     strncpy(data.selected_file, data.file_data->last_loaded_file, FILE_NAME_MAX);
     input_box_start(&file_name_input, data.typed_name, FILE_NAME_MAX, 0);
 }
 
+static const char *get_info_filename(void) {
+    // the summary shown is that of the file under the mouse, or else the selected one
+    if (data.focus_button_id && scrollbar.scroll_position + data.focus_button_id - 1 < data.file_list->num_files)
+        return data.file_list->files[scrollbar.scroll_position + data.focus_button_id - 1];
+    return data.selected_file;
+}
+
+static void draw_saved_game_info(void) {
+    const saved_game_info *info = game_save_index_get(get_info_filename());
+    if (!info)
+        return;
+    text_draw(info->scenario_name, 160, 370, FONT_NORMAL_BLACK, 0);
+    lang_text_draw_month_year_max_width(info->month, info->year, 320, 370, 128, FONT_NORMAL_BLACK, 0);
+    int width = lang_text_draw(6, 0, 160, 390, FONT_NORMAL_BLACK);
+    text_draw_number(info->treasury, '@', " ", 165 + width, 390, FONT_NORMAL_BLACK);
+    width = lang_text_draw(6, 1, 320, 390, FONT_NORMAL_BLACK);
+    text_draw_number(info->population, '@', " ", 325 + width, 390, FONT_NORMAL_BLACK);
+}
+
 static void draw_foreground(void) {
     graphics_in_dialog();
     uint8_t file[FILE_NAME_MAX];
 
-    outer_panel_draw(128, 40, 24, 21);
+    outer_panel_draw(128, 40, 24, data.type == FILE_TYPE_SAVED_GAME ? 24 : 21);
     input_box_draw(&file_name_input);
     inner_panel_draw(144, 120, 20, 13);
 
@@ -156,6 +183,9 @@ static void draw_foreground(void) {
         text_draw(file, 160, 130 + 16 * i, font, 0);
     }
 
+    if (data.type == FILE_TYPE_SAVED_GAME)
+        draw_saved_game_info();
+
     image_buttons_draw(0, 0, image_buttons, 2);
     scrollbar_draw(&scrollbar);
 
@@ -178,6 +208,7 @@ static const char *get_chosen_filename(void) {
     return typed_file;
 }
 static void button_ok_cancel(int is_ok, int param2) {
+    game_save_index_flush();
     if (!is_ok) {
         input_box_stop(&file_name_input);
         window_go_back();
@@ -233,6 +264,7 @@ static void button_ok_cancel(int is_ok, int param2) {
         if (game_file_delete_saved_game(filename)) {
             dir_find_files_with_extension(".", data.file_data->extension);
             dir_append_files_with_extension(saved_game_data_expanded.extension);
+            game_save_index_refresh(saved_game_dir(), data.file_list);
 
             if (scrollbar.scroll_position + NUM_FILES_IN_VIEW >= data.file_list->num_files)
                 --scrollbar.scroll_position;
@@ -270,12 +302,17 @@ static void handle_input(const mouse *m, const hotkeys *h) {
     }
 
     const mouse *m_dialog = mouse_in_dialog(m);
-    if (input_box_handle_mouse(m_dialog, &file_name_input) ||
-        generic_buttons_handle_mouse(m_dialog, 0, 0, file_buttons, NUM_FILES_IN_VIEW, &data.focus_button_id) ||
-        image_buttons_handle_mouse(m_dialog, 0, 0, image_buttons, 2, 0) ||
-        scrollbar_handle_mouse(&scrollbar, m_dialog))
+    int handled = input_box_handle_mouse(m_dialog, &file_name_input) ||
+                  generic_buttons_handle_mouse(m_dialog, 0, 0, file_buttons, NUM_FILES_IN_VIEW, &data.focus_button_id) ||
+                  image_buttons_handle_mouse(m_dialog, 0, 0, image_buttons, 2, 0) ||
+                  scrollbar_handle_mouse(&scrollbar, m_dialog);
+    // read a missing summary when the file under the mouse or the selection changes, never while drawing
+    if (data.type == FILE_TYPE_SAVED_GAME && window_is(WINDOW_FILE_DIALOG))
+        game_save_index_read_info(get_info_filename());
+    if (handled)
         return;
     if (input_go_back_requested(m, h)) {
+        game_save_index_flush();
         input_box_stop(&file_name_input);
         window_go_back();
     }
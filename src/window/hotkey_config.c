@@ -54,10 +54,13 @@ static hotkey_widget hotkey_widgets[] = {
         {HOTKEY_SAVE_CITY_SCREENSHOT,       TR_HOTKEY_SAVE_CITY_SCREENSHOT},
         {HOTKEY_LOAD_FILE,                  TR_HOTKEY_LOAD_FILE},
         {HOTKEY_SAVE_FILE,                  TR_HOTKEY_SAVE_FILE},
+        {HOTKEY_QUICKSAVE,                  TR_HOTKEY_QUICKSAVE},
+        {HOTKEY_QUICKLOAD,                  TR_HOTKEY_QUICKLOAD},
         {HOTKEY_HEADER,                     TR_HOTKEY_HEADER_CITY},
         {HOTKEY_INCREASE_GAME_SPEED,        TR_HOTKEY_INCREASE_GAME_SPEED},
         {HOTKEY_DECREASE_GAME_SPEED,        TR_HOTKEY_DECREASE_GAME_SPEED},
         {HOTKEY_TOGGLE_PAUSE,               TR_HOTKEY_TOGGLE_PAUSE},
+        {HOTKEY_TOGGLE_FAST_FORWARD,        TR_HOTKEY_TOGGLE_FAST_FORWARD},
         {HOTKEY_CYCLE_LEGION,               TR_HOTKEY_CYCLE_LEGION},
         {HOTKEY_ROTATE_MAP_LEFT,            TR_HOTKEY_ROTATE_MAP_LEFT},
         {HOTKEY_ROTATE_MAP_RIGHT,           TR_HOTKEY_ROTATE_MAP_RIGHT},
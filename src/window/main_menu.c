@@ -3,6 +3,7 @@
 #include "core/string.h"
 #include "core/game_environment.h"
 #include "editor/editor.h"
+#include "game/fast_forward.h"
 #include "game/game.h"
 #include "game/system.h"
 #include "graphics/generic_button.h"
@@ -148,6 +149,7 @@ static void handle_input(const mouse *m, const hotkeys *h) {
 
 }
 void window_main_menu_show(int restart_music) {
+    game_fast_forward_stop();
     if (restart_music)
         sound_music_play_intro();
     window_type window = {
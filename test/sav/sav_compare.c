@@ -1,12 +1,22 @@
 #include "../src/core/zip.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define SAVEGAME_PARTS 300
 #define COMPRESS_BUFFER_SIZE 600000
 #define UNCOMPRESSED 0x80000000
 
+// native saves: header, table of contents, then sections stored back to back
+#define NATIVE_MAGIC "OZSV"
+#define NATIVE_HEADER_SIZE 16
+#define NATIVE_TAG_LENGTH 32
+#define NATIVE_TOC_ENTRY_SIZE (NATIVE_TAG_LENGTH + 20)
+#define NATIVE_MAX_SECTIONS 210
+#define NATIVE_SECTION_COMPRESSED 1
+#define NATIVE_MAX_SIZE 8000000
+
 struct game_file_part {
     int compressed;
     int length_in_bytes;
@@ -233,6 +243,23 @@ static struct game_file_part save_game_parts[] = {
     {0, 0, ""},
 };
 
+// native saves always store these parts with the expanded limits of the game
+static const struct {
+    const char *name;
+    int length_in_bytes;
+} expanded_parts[] = {
+    {"figures", 640000},
+    {"route_figures", 6000},
+    {"route_paths", 1500000},
+    {"formations", 32000},
+    {"buildings", 1280000},
+    {"building_list_burning", 5000},
+    {"building_list_small", 5000},
+    {"building_list_large", 20000},
+    {"building_storages", 32000},
+    {0, 0}
+};
+
 static char compress_buffer[COMPRESS_BUFFER_SIZE];
 static unsigned char file1_data[1300000];
 static unsigned char file2_data[1300000];
@@ -293,6 +320,115 @@ static int read_compressed_chunk(FILE *fp, void *buffer, int bytes_to_read)
     return 1;
 }
 
+static int expanded_length_of_part(int index)
+{
+    for (int i = 0; expanded_parts[i].name; i++) {
+        if (strcmp(expanded_parts[i].name, save_game_parts[index].name) == 0) {
+            return expanded_parts[i].length_in_bytes;
+        }
+    }
+    return save_game_parts[index].length_in_bytes;
+}
+
+static int read_native_sections(FILE *fp, unsigned char *data, const char *filename)
+{
+    unsigned char header[NATIVE_HEADER_SIZE];
+    if (fread(header, 1, NATIVE_HEADER_SIZE, fp) != NATIVE_HEADER_SIZE) {
+        return 0;
+    }
+    int engine = (int) to_uint(&header[8]);
+    int num_sections = (int) to_uint(&header[12]);
+    if (engine != 0 || num_sections < 0 || num_sections > NATIVE_MAX_SECTIONS) {
+        printf("Unsupported native save %s: engine %d, %d sections\n", filename, engine, num_sections);
+        return 0;
+    }
+    static unsigned char toc[NATIVE_MAX_SECTIONS * NATIVE_TOC_ENTRY_SIZE];
+    if (fread(toc, 1, num_sections * NATIVE_TOC_ENTRY_SIZE, fp) != num_sections * NATIVE_TOC_ENTRY_SIZE) {
+        return 0;
+    }
+    int length = 0;
+    for (int i = 0; i < num_sections; i++) {
+        const unsigned char *entry = &toc[i * NATIVE_TOC_ENTRY_SIZE];
+        char tag[NATIVE_TAG_LENGTH];
+        memcpy(tag, entry, NATIVE_TAG_LENGTH);
+        tag[NATIVE_TAG_LENGTH - 1] = 0;
+        unsigned int offset = to_uint(&entry[NATIVE_TAG_LENGTH]);
+        unsigned int stored_size = to_uint(&entry[NATIVE_TAG_LENGTH + 4]);
+        int raw_size = (int) to_uint(&entry[NATIVE_TAG_LENGTH + 8]);
+        unsigned int flags = to_uint(&entry[NATIVE_TAG_LENGTH + 16]);
+        if (strcmp(tag, "delta_base") == 0) {
+            printf("%s is a delta save: load it in the game and save it again to compare it\n", filename);
+            return 0;
+        }
+        if (strcmp(tag, "info") == 0) {
+            // summary for the load dialog, not part of the game state
+            continue;
+        }
+        if (raw_size < 0 || raw_size > NATIVE_MAX_SIZE - length || fseek(fp, offset, SEEK_SET)) {
+            printf("Invalid section %s in %s\n", tag, filename);
+            return 0;
+        }
+        int output_size = raw_size;
+        int result;
+        if (flags & NATIVE_SECTION_COMPRESSED) {
+            unsigned char *stored = (unsigned char *) malloc(stored_size);
+            result = stored && fread(stored, 1, stored_size, fp) == stored_size
+                && zip_decompress(stored, stored_size, &data[length], &output_size) && output_size == raw_size;
+            free(stored);
+        } else {
+            result = fread(&data[length], 1, raw_size, fp) == raw_size;
+        }
+        if (!result) {
+            printf("Unable to read section %s in %s\n", tag, filename);
+            return 0;
+        }
+        length += raw_size;
+    }
+    return length;
+}
+
+static int unpack_native(FILE *fp, const char *filename, unsigned char *buffer)
+{
+    // the sections in file order form the expanded layout: copy every part into the
+    // layout used here, parts that only fit the expanded limits are reported
+    unsigned char *data = (unsigned char *) malloc(NATIVE_MAX_SIZE);
+    if (!data) {
+        return 0;
+    }
+    int length = read_native_sections(fp, data, filename);
+    int offset = 0;
+    int native_offset = 0;
+    for (int i = 0; length && save_game_parts[i].length_in_bytes; i++) {
+        int part_length = save_game_parts[i].length_in_bytes;
+        int native_length = expanded_length_of_part(i);
+        if (native_offset + native_length > length) {
+            printf("Native save %s is too short for part %s\n", filename, save_game_parts[i].name);
+            offset = 0;
+            break;
+        }
+        memcpy(&buffer[offset], &data[native_offset], part_length);
+        for (int j = part_length; j < native_length; j++) {
+            if (data[native_offset + j]) {
+                printf("WARN: %s uses more of part %s than the original game allows\n",
+                    filename, save_game_parts[i].name);
+                break;
+            }
+        }
+        offset += part_length;
+        native_offset += native_length;
+    }
+    free(data);
+    return offset;
+}
+
+static int is_native(FILE *fp)
+{
+    char magic[4];
+    int result = fread(magic, 1, 4, fp) == 4 && memcmp(magic, NATIVE_MAGIC, 4) == 0;
+    fseek(fp, 0, SEEK_SET);
+    return result;
+}
+
 static int unpack(const char *filename, unsigned char *buffer)
 {
     FILE *fp = fopen(filename, "rb");
@@ -300,6 +436,11 @@ static int unpack(const char *filename, unsigned char *buffer)
         printf("Unable to open file %s\n", filename);
         return 0;
     }
+    if (is_native(fp)) {
+        int length = unpack_native(fp, filename, buffer);
+        fclose(fp);
+        return length;
+    }
     int offset = 0;
     for (int i = 0; save_game_parts[i].length_in_bytes; i++) {
         int result = 0;
@@ -319,7 +460,7 @@ static int unpack(const char *filename, unsigned char *buffer)
     return offset;
 }
 
-static int has_adjacent_int(int part_offset, int int)
+static int has_adjacent_int(int part_offset, int building_type)
 {
     int grid_offset = part_offset / 2;
     const int adjacent_tiles[] = { -162, 1, 162, -1 };
@@ -332,7 +473,7 @@ static int has_adjacent_int(int part_offset, int int)
         int building_id = to_ushort(&file1_data[offset_of_part("building_grid") + adjacent_offset * 2]);
         int building_offset = offset_of_part("buildings") + building_id * 128;
         int type = to_ushort(&file1_data[building_offset + 10]);
-        if (type == int) {
+        if (type == building_type) {
             return 1;
         }
     }
@@ -488,7 +629,7 @@ static int compare_part(int index, int offset)
 
 static void print_game_time(unsigned char *data)
 {
-    int offset_tick = 1200222;
+    int offset_tick = offset_of_part("game_time.tick");
     unsigned int tick = to_uint(&data[offset_tick]);
     unsigned int day = to_uint(&data[offset_tick + 4]);
     unsigned int month = to_uint(&data[offset_tick + 8]);
@@ -500,7 +641,7 @@ static void print_game_time(unsigned char *data)
 
 static void compare_game_time(void)
 {
-    int offset_tick = 1200222;
+    int offset_tick = offset_of_part("game_time.tick");
     int offset_days = offset_tick + 16;
     unsigned int ticks1 = to_uint(&file1_data[offset_tick]) + 50 * to_uint(&file1_data[offset_days]);
     unsigned int ticks2 = to_uint(&file2_data[offset_tick]) + 50 * to_uint(&file2_data[offset_days]);
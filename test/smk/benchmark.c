@@ -0,0 +1,55 @@
+#include "core/smacker.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// Decodes every frame of the given videos and reports the time spent decoding per frame,
+// together with a checksum of the decoded pixels to compare decoder changes.
+// Only the decoder calls are timed: the checksum is computed outside of them.
+static int benchmark_file(const char *filename)
+{
+    FILE *fp = fopen(filename, "rb");
+    smacker s = smacker_open(fp);
+    if (!s) {
+        printf("%s: unable to open\n", filename);
+        return 0;
+    }
+    int width, height, frame_count;
+    smacker_get_video_info(s, &width, &height, 0);
+    smacker_get_frames_info(s, &frame_count, 0);
+
+    unsigned int checksum = 0;
+    int frames = 0;
+    clock_t start = clock();
+    smacker_frame_status status = smacker_first_frame(s);
+    clock_t decoding = clock() - start;
+    while (status == SMACKER_FRAME_OK) {
+        const uint8_t *video = smacker_get_frame_video(s);
+        for (int i = 0; i < width * height; i++) {
+            checksum = checksum * 31 + video[i];
+        }
+        frames++;
+        start = clock();
+        status = smacker_next_frame(s);
+        decoding += clock() - start;
+    }
+    double millis = decoding * 1000.0 / CLOCKS_PER_SEC;
+    smacker_close(s);
+
+    printf("%s: %dx%d, %d/%d frames, %.3f ms/frame, checksum %08x\n", filename, width, height,
+        frames, frame_count, frames ? millis / frames : 0.0, checksum);
+    return status != SMACKER_FRAME_ERROR;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("Usage: %s FILE.smk...\n", argv[0]);
+        return 1;
+    }
+    int ok = 1;
+    for (int i = 1; i < argc; i++) {
+        ok &= benchmark_file(argv[i]);
+    }
+    return ok ? 0 : 1;
+}
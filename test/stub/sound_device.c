@@ -14,6 +14,9 @@ int sound_device_is_channel_playing(int channel)
     return 0;
 }
 
+void sound_device_prefetch_channels(int first, int last)
+{}
+
 void sound_device_set_music_volume(int volume_pct)
 {}
 
@@ -1,4 +1,6 @@
+#include "figure/figure.h"
 #include "graphics/window.h"
+#include "window/console.h"
 #include "window/message_dialog.h"
 #include "window/popup_dialog.h"
 #include "window/mission_end.h"
@@ -71,3 +73,11 @@ void window_city_show(void)
 
 void window_console_show(int type, int dialog_type)
 {}
+
+void window_console_show(void)
+{}
+
+bool figure::has_figure_color()
+{
+    return false;
+}